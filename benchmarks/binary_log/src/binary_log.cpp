@@ -0,0 +1,74 @@
+/**
+ * @file binary_log.cpp
+ * @author Esteban Duran (@astroesteban)
+ * @brief Compares the cost of a TM4C_LOG call with formatting the same
+ *        message with snprintf.
+ *
+ * The ring is drained after every sample so no record is dropped. Once
+ * `done` is set, read `results` with the debugger and the records of the last
+ * samples with utils/decode_log.py.
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#include "benchmark.hpp"
+#include "tm4c_log.h"
+
+namespace {
+    constexpr std::uint32_t SAMPLES = 1000;
+
+    char text[64];
+    volatile std::int32_t millivolts = -1234;
+    volatile std::uint32_t channel = 3;
+    volatile float temperature = 21.5f;
+
+    std::size_t discard(const void *, std::size_t size) {
+        return size;
+    }
+
+    template <typename Function>
+    void sample(benchmark::Stats &stats, Function &&function) {
+        const std::uint32_t start = tm4c_cycles();
+        function();
+        stats.add(tm4c_cycles() - start);
+    }
+}
+
+struct Results {
+    benchmark::Stats log_no_args;
+    benchmark::Stats log_two_args;
+    benchmark::Stats log_float;
+    benchmark::Stats snprintf_two_args;
+    benchmark::Stats snprintf_float;
+};
+
+constinit Results results;
+constinit volatile bool done = false;
+
+int main() {
+    for (std::uint32_t i = 0; i < SAMPLES; i++) {
+        sample(results.log_no_args, [] { TM4C_LOG("tick"); });
+        sample(results.log_two_args, [] { TM4C_LOG("adc %u: %d mV", channel, millivolts); });
+        sample(results.log_float, [] { TM4C_LOG("temperature %.1f C", temperature); });
+        tm4c_log_drain(discard);
+    }
+
+    results.snprintf_two_args = benchmark::measure(SAMPLES, [] {
+        std::snprintf(text, sizeof(text), "adc %u: %d mV", static_cast<unsigned>(channel),
+                      static_cast<int>(millivolts));
+    });
+    results.snprintf_float = benchmark::measure(SAMPLES, [] {
+        std::snprintf(text, sizeof(text), "temperature %.1f C", static_cast<double>(temperature));
+    });
+
+    done = true;
+
+    while (true);
+}
@@ -0,0 +1,95 @@
+/**
+ * @file bitband.cpp
+ * @author Esteban Duran (@astroesteban)
+ * @brief Compares flags an ISR and the main loop share in one word, set and
+ *        cleared with a PRIMASK critical section around the read-modify-write
+ *        or through the bit-band alias (tm4c::bitband::BitFlag).
+ *
+ * Both variants are measured from the main loop and from an ISR, which is
+ * triggered from software and timed until it returned. The critical section
+ * also holds back every interrupt while it runs, the bit-band store does
+ * not. Once `done` is set, read `results` with the debugger.
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#include <cstdint>
+
+#include "benchmark.hpp"
+#include "tm4c_bitband.hpp"
+#include "tm4c_interrupts.hpp"
+
+namespace {
+    constexpr tm4c::Irq CRITICAL_IRQ = tm4c::Irq::Timer0A;
+    constexpr tm4c::Irq BITBAND_IRQ = tm4c::Irq::Timer1A;
+    constexpr std::uint32_t SAMPLES = 1000;
+
+    // the main loop owns flag 0, the ISRs flag 1
+    constexpr unsigned MAIN_FLAG = 0;
+    constexpr unsigned ISR_FLAG = 1;
+
+    volatile std::uint32_t critical_flags;
+    constinit tm4c::bitband::BitFlag<2> bitband_flags;
+
+    [[gnu::always_inline]] inline std::uint32_t lock() {
+        std::uint32_t primask;
+        __asm volatile ("mrs %0, primask\n\tcpsid i" : "=r"(primask) :: "memory");
+        return primask;
+    }
+
+    [[gnu::always_inline]] inline void unlock(std::uint32_t primask) {
+        __asm volatile ("msr primask, %0" :: "r"(primask) : "memory");
+    }
+
+    [[gnu::always_inline]] inline void critical_set(unsigned flag) {
+        const std::uint32_t primask = lock();
+        critical_flags = critical_flags | (1U << flag);
+        unlock(primask);
+    }
+
+    [[gnu::always_inline]] inline void critical_clear(unsigned flag) {
+        const std::uint32_t primask = lock();
+        critical_flags = critical_flags & ~(1U << flag);
+        unlock(primask);
+    }
+}
+
+struct Results {
+    benchmark::Stats critical_set;
+    benchmark::Stats critical_clear;
+    benchmark::Stats critical_isr;
+    benchmark::Stats bitband_set;
+    benchmark::Stats bitband_clear;
+    benchmark::Stats bitband_isr;
+};
+
+constinit Results results;
+constinit volatile bool done = false;
+
+extern "C" void Timer0A_ISR() {
+    critical_set(ISR_FLAG);
+}
+
+extern "C" void Timer1A_ISR() {
+    bitband_flags.set(ISR_FLAG);
+}
+
+int main() {
+    tm4c::enable(CRITICAL_IRQ);
+    tm4c::enable(BITBAND_IRQ);
+
+    results.critical_set = benchmark::measure(SAMPLES, [] { critical_set(MAIN_FLAG); });
+    results.critical_clear = benchmark::measure(SAMPLES, [] { critical_clear(MAIN_FLAG); });
+    results.critical_isr = benchmark::measure(SAMPLES, [] { benchmark::trigger_irq(CRITICAL_IRQ); });
+
+    results.bitband_set = benchmark::measure(SAMPLES, [] { bitband_flags.set(MAIN_FLAG); });
+    results.bitband_clear = benchmark::measure(SAMPLES, [] { bitband_flags.clear(MAIN_FLAG); });
+    results.bitband_isr = benchmark::measure(SAMPLES, [] { benchmark::trigger_irq(BITBAND_IRQ); });
+
+    done = true;
+
+    while (true);
+}
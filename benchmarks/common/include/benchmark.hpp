@@ -0,0 +1,69 @@
+/**
+ * @file benchmark.hpp
+ * @author Esteban Duran (@astroesteban)
+ * @brief Helpers shared by the on-target benchmarks. Results are collected in
+ *        global variables so they can be read with the debugger
+ *        (e.g. `p results` in GDB) after the benchmark finished.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+#include "tm4c_cycles.h"
+#include "tm4c_interrupts.hpp"
+
+namespace benchmark {
+
+/**
+ * @brief Minimum, maximum and average of a series of cycle measurements.
+ */
+struct Stats {
+    std::uint32_t min = std::numeric_limits<std::uint32_t>::max();
+    std::uint32_t max = 0;
+    std::uint64_t total = 0;
+    std::uint32_t count = 0;
+
+    void add(std::uint32_t cycles) {
+        min = cycles < min ? cycles : min;
+        max = cycles > max ? cycles : max;
+        total += cycles;
+        count++;
+    }
+
+    [[nodiscard]] std::uint32_t average() const {
+        return count == 0 ? 0 : static_cast<std::uint32_t>(total / count);
+    }
+};
+
+/**
+ * @brief Measures the cycles one call of the function takes, sampled the
+ *        given number of times.
+ */
+template <typename Function>
+Stats measure(std::uint32_t samples, Function &&function) {
+    Stats stats{};
+
+    for (std::uint32_t i = 0; i < samples; i++) {
+        const std::uint32_t start = tm4c_cycles();
+        function();
+        stats.add(tm4c_cycles() - start);
+    }
+
+    return stats;
+}
+
+/**
+ * @brief Pends the interrupt from software and waits for it to be taken. The
+ *        ISR has finished by the time this returns.
+ */
+inline void trigger_irq(tm4c::Irq irq) {
+    tm4c::pend(irq);
+}
+
+} // namespace benchmark
@@ -0,0 +1,74 @@
+/**
+ * @file format.cpp
+ * @author Esteban Duran (@astroesteban)
+ * @brief Formats an integer, a hex value and a float into a buffer with
+ *        newlib-nano's snprintf or with tm4c::snformat.
+ *
+ * The same source is built twice: `format_printf` with FORMAT_WITH_PRINTF and
+ * `_printf_float` linked in, and `format_tm4c`. Both print their flash and
+ * RAM usage when they are linked; the difference is what each formatter
+ * costs. Once `done` is set, read `results` with the debugger. `text` holds
+ * the last float so both variants can be checked for the same output.
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#include <cstddef>
+#include <cstdint>
+
+#include "benchmark.hpp"
+
+#if defined(FORMAT_WITH_PRINTF)
+#include <cstdio>
+#else
+#include "tm4c_format.hpp"
+#endif
+
+namespace {
+    constexpr std::uint32_t SAMPLES = 1000;
+
+    volatile std::int32_t millivolts = -1234;
+    volatile std::uint32_t status = 0x2A5;
+    volatile float temperature = 21.56f;
+}
+
+struct Results {
+    benchmark::Stats integer;
+    benchmark::Stats hex;
+    benchmark::Stats floating;
+};
+
+constinit Results results;
+constinit char text[32];
+constinit volatile bool done = false;
+
+int main() {
+#if defined(FORMAT_WITH_PRINTF)
+    results.integer = benchmark::measure(SAMPLES, [] {
+        std::snprintf(text, sizeof(text), "adc: %d mV", static_cast<int>(millivolts));
+    });
+    results.hex = benchmark::measure(SAMPLES, [] {
+        std::snprintf(text, sizeof(text), "status %#010x", static_cast<unsigned>(status));
+    });
+    results.floating = benchmark::measure(SAMPLES, [] {
+        std::snprintf(text, sizeof(text), "temperature %.2f C", static_cast<double>(temperature));
+    });
+#else
+    results.integer = benchmark::measure(SAMPLES, [] {
+        tm4c::snformat(text, sizeof(text), "adc: {} mV", millivolts);
+    });
+    results.hex = benchmark::measure(SAMPLES, [] {
+        tm4c::snformat(text, sizeof(text), "status {:#010x}", status);
+    });
+    results.floating = benchmark::measure(SAMPLES, [] {
+        tm4c::snformat(text, sizeof(text), "temperature {:.2f} C", temperature);
+    });
+#endif
+
+    done = true;
+
+    while (true);
+}
@@ -0,0 +1,127 @@
+/**
+ * @file gpio_bus.cpp
+ * @author Esteban Duran (@astroesteban)
+ * @brief Compares driving a pin through the APB aperture of port F with the
+ *        AHB aperture (tm4c::gpio::Bus).
+ *
+ * Two numbers per bus, both on PF1 (the red LED, probe it with a scope to
+ * see the toggle frequency):
+ *   - toggle: cycles for TOGGLES set/clear pairs back to back, converted to
+ *     the highest frequency the pin can be toggled at.
+ *   - latency: cycles from pending an interrupt until its ISR sees the pin
+ *     high, the ISR sets the pin and reads it back until the level arrived.
+ *     This includes exception entry and the pin's input synchronizer.
+ *
+ * The port is moved between the buses at runtime (PinGroup::use_bus()),
+ * every access itself uses the aperture fixed at compile time. Once `done` is
+ * set, read `results` with the debugger.
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#include <cstdint>
+
+#include "benchmark.hpp"
+#include "tm4c_clock.hpp"
+#include "tm4c_cycles.h"
+#include "tm4c_gpio.hpp"
+#include "tm4c_interrupts.hpp"
+
+namespace {
+    using tm4c::gpio::Bus;
+    using tm4c::gpio::Port;
+
+    using ApbPin = tm4c::gpio::Pin<Port::F, 1, Bus::APB>;
+    using AhbPin = tm4c::gpio::Pin<Port::F, 1, Bus::AHB>;
+
+    constexpr tm4c::Irq APB_IRQ = tm4c::Irq::Timer0A;
+    constexpr tm4c::Irq AHB_IRQ = tm4c::Irq::Timer1A;
+    constexpr std::uint32_t SAMPLES = 1000;
+    constexpr std::uint32_t TOGGLES = 8;
+
+    volatile std::uint32_t pin_high_at;
+
+    template <typename P>
+    [[gnu::always_inline]] inline void toggle_burst() {
+        // unrolled, so only the stores are timed
+        P::set(); P::clear(); P::set(); P::clear();
+        P::set(); P::clear(); P::set(); P::clear();
+        P::set(); P::clear(); P::set(); P::clear();
+        P::set(); P::clear(); P::set(); P::clear();
+    }
+
+    template <typename P>
+    [[gnu::always_inline]] inline void set_and_wait() {
+        P::set();
+        while (!P::is_high()) {
+        }
+        pin_high_at = tm4c_cycles();
+    }
+
+    template <typename P>
+    benchmark::Stats latency(tm4c::Irq irq) {
+        benchmark::Stats stats{};
+
+        for (std::uint32_t i = 0; i < SAMPLES; i++) {
+            const std::uint32_t start = tm4c_cycles();
+            benchmark::trigger_irq(irq);
+            stats.add(pin_high_at - start);
+            P::clear();
+        }
+
+        return stats;
+    }
+
+    /// The frequency of the square wave one set/clear pair per period gives
+    std::uint32_t toggle_hz(const benchmark::Stats &stats) {
+        return static_cast<std::uint32_t>(
+            static_cast<std::uint64_t>(tm4c::clock::core_hz) * TOGGLES / stats.min);
+    }
+}
+
+struct Results {
+    benchmark::Stats apb_toggle;
+    benchmark::Stats ahb_toggle;
+    std::uint32_t apb_toggle_hz = 0;
+    std::uint32_t ahb_toggle_hz = 0;
+    benchmark::Stats apb_latency;
+    benchmark::Stats ahb_latency;
+};
+
+constinit Results results;
+constinit volatile bool done = false;
+
+extern "C" void Timer0A_ISR() {
+    set_and_wait<ApbPin>();
+}
+
+extern "C" void Timer1A_ISR() {
+    set_and_wait<AhbPin>();
+}
+
+int main() {
+    tm4c::enable(APB_IRQ);
+    tm4c::enable(AHB_IRQ);
+
+    ApbPin::enable();
+
+    ApbPin::use_bus();
+    ApbPin::make_output();
+    results.apb_toggle = benchmark::measure(SAMPLES, [] { toggle_burst<ApbPin>(); });
+    results.apb_latency = latency<ApbPin>(APB_IRQ);
+
+    AhbPin::use_bus();
+    AhbPin::make_output();
+    results.ahb_toggle = benchmark::measure(SAMPLES, [] { toggle_burst<AhbPin>(); });
+    results.ahb_latency = latency<AhbPin>(AHB_IRQ);
+
+    results.apb_toggle_hz = toggle_hz(results.apb_toggle);
+    results.ahb_toggle_hz = toggle_hz(results.ahb_toggle);
+
+    done = true;
+
+    while (true);
+}
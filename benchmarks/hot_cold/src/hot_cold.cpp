@@ -0,0 +1,104 @@
+/**
+ * @file hot_cold.cpp
+ * @author Esteban Duran (@astroesteban)
+ * @brief Measures an ISR and an inner loop whose helper functions are either
+ *        grouped in the aligned hot block at the start of FLASH (TM4C_HOT) or
+ *        scattered between rarely used code.
+ *
+ * The same source is built twice: `hot_cold_grouped` and
+ * `hot_cold_scattered`, the latter with TM4C_DISABLE_CODE_GROUPING so that
+ * the hot helpers stay in source order, interleaved with the filler
+ * functions. Run both at 80 MHz, where the flash needs wait states and the
+ * prefetch buffer decides how fast straight-line code runs, and compare
+ * `results`.
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#include <cstdint>
+
+#include "benchmark.hpp"
+#include "tm4c_clock.hpp"
+#include "tm4c_interrupts.hpp"
+#include "tm4c_sections.h"
+
+static_assert(tm4c::clock::core_hz == 80'000'000, "Run this benchmark at 80 MHz");
+
+// 64 instructions of code that is never executed but separates the hot
+// helpers from each other in the scattered layout
+#define FILLER(name)                                                          \
+    TM4C_COLD [[gnu::noinline]] void name() {                                 \
+        __asm volatile (".rept 64\n\tnop\n\t.endr");                         \
+    }
+
+namespace {
+    constexpr tm4c::Irq BENCHMARK_IRQ = tm4c::Irq::Timer0A;
+    constexpr std::uint32_t SAMPLES = 1000;
+    constexpr std::uint32_t LOOP_ITERATIONS = 256;
+
+    volatile std::uint32_t state = 1;
+    volatile bool never = false;
+
+    FILLER(filler0)
+
+    TM4C_HOT [[gnu::noinline]] std::uint32_t scramble(std::uint32_t value) {
+        value ^= value << 13;
+        value ^= value >> 17;
+        value ^= value << 5;
+        return value;
+    }
+
+    FILLER(filler1)
+
+    TM4C_HOT [[gnu::noinline]] std::uint32_t saturate(std::uint32_t value) {
+        return value > 0x7FFFFFFF ? 0x7FFFFFFF : value;
+    }
+
+    FILLER(filler2)
+
+    TM4C_HOT [[gnu::noinline]] void inner_loop() {
+        std::uint32_t value = state;
+
+        for (std::uint32_t i = 0; i < LOOP_ITERATIONS; i++) {
+            value = saturate(scramble(value)) + i;
+        }
+
+        state = value;
+    }
+
+    FILLER(filler3)
+}
+
+struct Results {
+    benchmark::Stats isr;
+    benchmark::Stats loop;
+};
+
+constinit Results results;
+constinit volatile bool done = false;
+
+extern "C" TM4C_HOT void Timer0A_ISR() {
+    state = saturate(scramble(state));
+}
+
+int main() {
+    // keep the fillers in the image
+    if (never) {
+        filler0();
+        filler1();
+        filler2();
+        filler3();
+    }
+
+    tm4c::enable(BENCHMARK_IRQ);
+
+    results.isr = benchmark::measure(SAMPLES, [] { benchmark::trigger_irq(BENCHMARK_IRQ); });
+    results.loop = benchmark::measure(SAMPLES, [] { inner_loop(); });
+
+    done = true;
+
+    while (true);
+}
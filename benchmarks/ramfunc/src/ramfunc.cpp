@@ -0,0 +1,75 @@
+/**
+ * @file ramfunc.cpp
+ * @author Esteban Duran (@astroesteban)
+ * @brief Compares a tight ISR executing from FLASH with the exact same ISR
+ *        executing from SRAM (TM4C_RAMFUNC).
+ *
+ * Both ISRs are triggered from software and timed from the store to the
+ * software trigger register until the ISR returned, so the numbers include
+ * exception entry and exit. Once `done` is set, read `results` with the
+ * debugger.
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#include <array>
+#include <cstdint>
+
+#include "benchmark.hpp"
+#include "tm4c_interrupts.hpp"
+#include "tm4c_sections.h"
+
+namespace {
+    constexpr tm4c::Irq FLASH_IRQ = tm4c::Irq::Timer0A;
+    constexpr tm4c::Irq SRAM_IRQ = tm4c::Irq::Timer1A;
+    constexpr std::uint32_t SAMPLES = 1000;
+
+    // a small FIR filter as a stand-in for a typical signal processing ISR
+    std::array<std::int32_t, 16> coefficients{1, -2, 3, -4, 5, -6, 7, -8,
+                                              8, -7, 6, -5, 4, -3, 2, -1};
+    std::array<std::int32_t, 16> history{};
+    volatile std::int32_t output;
+
+    [[gnu::always_inline]] inline void filter_step() {
+        std::int32_t accumulator = 0;
+
+        for (std::size_t i = history.size() - 1; i > 0; i--) {
+            history[i] = history[i - 1];
+            accumulator += history[i] * coefficients[i];
+        }
+
+        history[0] = output + 1;
+        output = accumulator + history[0] * coefficients[0];
+    }
+}
+
+struct Results {
+    benchmark::Stats flash;
+    benchmark::Stats sram;
+};
+
+constinit Results results;
+constinit volatile bool done = false;
+
+extern "C" void Timer0A_ISR() {
+    filter_step();
+}
+
+extern "C" TM4C_RAMFUNC void Timer1A_ISR() {
+    filter_step();
+}
+
+int main() {
+    tm4c::enable(FLASH_IRQ);
+    tm4c::enable(SRAM_IRQ);
+
+    results.flash = benchmark::measure(SAMPLES, [] { benchmark::trigger_irq(FLASH_IRQ); });
+    results.sram = benchmark::measure(SAMPLES, [] { benchmark::trigger_irq(SRAM_IRQ); });
+
+    done = true;
+
+    while (true);
+}
@@ -0,0 +1,107 @@
+/**
+ * @file clock.c
+ * @author Esteban Duran (@astroesteban)
+ * @brief Brings up the clock tree described in tm4c_clock.h.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @ref TM4C123GH6PM datasheet section 5.3 (Initialization and Configuration)
+ *
+ * @copyright Apache License
+ *
+ */
+#include "tm4c_clock.h"
+
+// +--------------------------------------------------------------------------+
+// +			        Type Definitions and Macros                           +
+// +--------------------------------------------------------------------------+
+#define SYSCTL_RIS     (*((volatile uint32_t *)0x400FE050)) // Raw Interrupt Status
+#define SYSCTL_RCC     (*((volatile uint32_t *)0x400FE060)) // Run-Mode Clock Configuration
+#define SYSCTL_RCC2    (*((volatile uint32_t *)0x400FE070)) // Run-Mode Clock Configuration 2
+#define SYSCTL_PLLSTAT (*((volatile uint32_t *)0x400FE168)) // PLL Status
+
+#define SYSCTL_RIS_MOSCPUPRIS (1UL << 8)     // main oscillator powered up
+#define SYSCTL_PLLSTAT_LOCK   (1UL << 0)     // PLL is locked
+
+#define SYSCTL_RCC_MOSCDIS    (1UL << 0)     // main oscillator disable
+#define SYSCTL_RCC_XTAL_S     6
+#define SYSCTL_RCC_XTAL_M     (0x1FUL << SYSCTL_RCC_XTAL_S)
+#define SYSCTL_RCC_USESYSDIV  (1UL << 22)    // use the system clock divider
+
+#define SYSCTL_RCC2_USERCC2   (1UL << 31)    // RCC2 overrides RCC
+#define SYSCTL_RCC2_DIV400    (1UL << 30)    // divide the 400 MHz PLL directly
+#define SYSCTL_RCC2_SYSDIV2_S 23
+#define SYSCTL_RCC2_SYSDIV2_M (0x3FUL << SYSCTL_RCC2_SYSDIV2_S)
+#define SYSCTL_RCC2_SYSDIV2LSB (1UL << 22)
+#define SYSCTL_RCC2_PWRDN2    (1UL << 13)    // power down the PLL
+#define SYSCTL_RCC2_BYPASS2   (1UL << 11)    // bypass the PLL
+#define SYSCTL_RCC2_OSCSRC2_M (0x7UL << 4)
+#define SYSCTL_RCC2_OSCSRC2_MO (0x0UL << 4)  // main oscillator
+#define SYSCTL_RCC2_OSCSRC2_IO (0x1UL << 4)  // precision internal oscillator
+
+#if defined(TM4C_CLOCK_SOURCE_MOSC)
+#define SYSCTL_RCC2_OSCSRC2 SYSCTL_RCC2_OSCSRC2_MO
+#else
+#define SYSCTL_RCC2_OSCSRC2 SYSCTL_RCC2_OSCSRC2_IO
+#endif
+
+/*
+ * Value of the divider field(s) in RCC2. With DIV400 the divisor spans the
+ * 7 bits SYSDIV2:SYSDIV2LSB, without it only the 6 bits of SYSDIV2.
+*/
+#if TM4C_CLOCK_USE_PLL
+#define SYSCTL_RCC2_DIVISOR                                                   \
+    (SYSCTL_RCC2_DIV400 | ((TM4C_SYSDIV - 1UL) << 22))
+#else
+#define SYSCTL_RCC2_DIVISOR ((TM4C_SYSDIV - 1UL) << SYSCTL_RCC2_SYSDIV2_S)
+#endif
+
+
+// +--------------------------------------------------------------------------+
+// +                          Function Definitions                            +
+// +--------------------------------------------------------------------------+
+void tm4c_clock_init(void) {
+    uint32_t rcc = SYSCTL_RCC;
+    uint32_t rcc2 = SYSCTL_RCC2;
+
+    // 1. Run from the raw oscillator while we reconfigure the clock tree
+    rcc2 |= SYSCTL_RCC2_USERCC2 | SYSCTL_RCC2_BYPASS2;
+    rcc &= ~SYSCTL_RCC_USESYSDIV;
+    SYSCTL_RCC2 = rcc2;
+    SYSCTL_RCC = rcc;
+
+    // 2. Select the crystal value and the oscillator source
+    rcc = (rcc & ~SYSCTL_RCC_XTAL_M) | ((uint32_t)TM4C_RCC_XTAL << SYSCTL_RCC_XTAL_S);
+#if defined(TM4C_CLOCK_SOURCE_MOSC)
+    rcc &= ~SYSCTL_RCC_MOSCDIS;
+#endif
+    rcc2 = (rcc2 & ~SYSCTL_RCC2_OSCSRC2_M) | SYSCTL_RCC2_OSCSRC2;
+    SYSCTL_RCC = rcc;
+    SYSCTL_RCC2 = rcc2;
+
+#if defined(TM4C_CLOCK_SOURCE_MOSC)
+    // the crystal needs some time to start oscillating
+    while ((SYSCTL_RIS & SYSCTL_RIS_MOSCPUPRIS) == 0);
+#endif
+
+    // 3. Power the PLL up (or down if we don't need it) and set the divisor
+#if TM4C_CLOCK_USE_PLL
+    rcc2 &= ~SYSCTL_RCC2_PWRDN2;
+#else
+    rcc2 |= SYSCTL_RCC2_PWRDN2;
+#endif
+    rcc2 &= ~(SYSCTL_RCC2_DIV400 | SYSCTL_RCC2_SYSDIV2_M | SYSCTL_RCC2_SYSDIV2LSB);
+    rcc2 |= SYSCTL_RCC2_DIVISOR;
+    if (TM4C_SYSDIV > 1) {
+        rcc |= SYSCTL_RCC_USESYSDIV;
+    }
+    SYSCTL_RCC = rcc;
+    SYSCTL_RCC2 = rcc2;
+
+    // 4. Wait for the PLL to lock and switch over to it
+#if TM4C_CLOCK_USE_PLL
+    while ((SYSCTL_PLLSTAT & SYSCTL_PLLSTAT_LOCK) == 0);
+    rcc2 &= ~SYSCTL_RCC2_BYPASS2;
+    SYSCTL_RCC2 = rcc2;
+#endif
+}
@@ -0,0 +1,39 @@
+/**
+ * @file crc.c
+ * @author Esteban Duran (@astroesteban)
+ * @brief CRC-32 using a 16 entry (nibble) table, a good trade-off between
+ *        speed and the 1 KB a full byte table costs in flash.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#include "tm4c_crc.h"
+
+// +--------------------------------------------------------------------------+
+// +					Global Variables definition	    				      +
+// +--------------------------------------------------------------------------+
+static const uint32_t crc32_nibble_table[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC,
+    0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+    0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C,
+};
+
+
+// +--------------------------------------------------------------------------+
+// +                          Function Definitions                            +
+// +--------------------------------------------------------------------------+
+uint32_t tm4c_crc32(uint32_t crc, const void *data, size_t size) {
+    const uint8_t *bytes = (const uint8_t *)data;
+
+    crc = ~crc;
+    while (size-- != 0) {
+        crc ^= *bytes++;
+        crc = (crc >> 4) ^ crc32_nibble_table[crc & 0x0F];
+        crc = (crc >> 4) ^ crc32_nibble_table[crc & 0x0F];
+    }
+
+    return ~crc;
+}
@@ -0,0 +1,372 @@
+/**
+ * @file eeprom.c
+ * @author Esteban Duran (@astroesteban)
+ * @brief The cached EEPROM key-value store described in tm4c_eeprom.h.
+ *
+ * @details The cache mirrors the first TM4C_EEPROM_CACHE bytes of the EEPROM
+ *          word for word: a magic word, the records one after the other and
+ *          an end word of all ones behind them. A bitmap remembers the words
+ *          the EEPROM does not have yet.
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @ref TM4C123GH6PM datasheet section 8.2.4 (EEPROM)
+ *
+ * @copyright Apache License
+ *
+ */
+#include "tm4c_eeprom.h"
+
+#include <assert.h>
+#include <errno.h>
+#include <string.h>
+
+#include "tm4c_crc.h"
+
+// +--------------------------------------------------------------------------+
+// +			        Type Definitions and Macros                           +
+// +--------------------------------------------------------------------------+
+
+static_assert(TM4C_EEPROM_CACHE % 64 == 0 && TM4C_EEPROM_CACHE >= 64 &&
+                  TM4C_EEPROM_CACHE <= TM4C_EEPROM_SIZE,
+              "TM4C_EEPROM_CACHE must be a multiple of 64 (an EEPROM block) up to 2 KB");
+
+/*
+ * The host tests (test/host) build this file against a simulated EEPROM,
+ * every register access goes through the hooks there.
+ */
+#if defined(TM4C_EEPROM_SIMULATED)
+uint32_t tm4c_eeprom_sim_read(uint32_t address);
+void tm4c_eeprom_sim_write(uint32_t address, uint32_t value);
+#define REG_READ(address) tm4c_eeprom_sim_read(address)
+#define REG_WRITE(address, value) tm4c_eeprom_sim_write(address, value)
+#else
+#define REG_READ(address) (*((volatile uint32_t *)(address)))
+#define REG_WRITE(address, value) (*((volatile uint32_t *)(address)) = (uint32_t)(value))
+#endif
+
+#define EEPROM_EESIZE       0x400AF000UL    // Size Information
+#define EEPROM_EEBLOCK      0x400AF004UL    // Current Block
+#define EEPROM_EEOFFSET     0x400AF008UL    // Current Offset
+#define EEPROM_EERDWRINC    0x400AF014UL    // Read-Write with Increment
+#define EEPROM_EEDONE       0x400AF018UL    // Done Status
+#define EEPROM_EESUPP       0x400AF01CUL    // Support Control and Status
+#define SYSCTL_SREEPROM     0x400FE558UL    // EEPROM Software Reset
+#define SYSCTL_RCGCEEPROM   0x400FE658UL    // EEPROM Run Mode Clock Gating
+#define SYSCTL_PREEPROM     0x400FEA58UL    // EEPROM Peripheral Ready
+
+#define EEDONE_WORKING      (1UL << 0)
+#define EEDONE_NOPERM       (1UL << 4)      // write to a protected block
+#define EEDONE_INVPL        (1UL << 8)      // supply voltage out of range
+#define EESUPP_ERETRY       (1UL << 2)      // an erase failed
+#define EESUPP_PRETRY       (1UL << 3)      // a program failed
+#define EESIZE_WORDCNT_M    0xFFFFUL
+
+#define WORDS_PER_BLOCK     16U
+#define CACHE_WORDS         (TM4C_EEPROM_CACHE / 4)
+#define STORE_MAGIC         0x31454554UL    // "TEE1"
+#define END                 0xFFFFFFFFUL    // behind the last record, erased EEPROM
+#define NONE                CACHE_WORDS
+
+#if defined(TM4C_EEPROM_CRC)
+#define CRC_WORDS 1U
+#else
+#define CRC_WORDS 0U
+#endif
+
+#define WORDS(bytes)        (((bytes) + 3U) / 4U)
+#define HEADER(key, size)   (((uint32_t)(key) << 16) | (uint32_t)(size))
+#define HEADER_KEY(header)  ((header) >> 16)
+#define HEADER_SIZE(header) ((header) & 0xFFFFU)
+#define RECORD_WORDS(size)  (1U + WORDS(size) + CRC_WORDS)
+
+
+// +--------------------------------------------------------------------------+
+// +					Global Variables definition	    				      +
+// +--------------------------------------------------------------------------+
+static int initialized;
+static uint32_t cache[CACHE_WORDS];
+static uint32_t dirty[(CACHE_WORDS + 31) / 32];
+static uint32_t end;                // word of the end marker
+static uint32_t commit_word = NONE; // the old end marker a new record replaces, written last
+static tm4c_eeprom_stats_t stats;
+
+
+// +--------------------------------------------------------------------------+
+// +                          Function Definitions                            +
+// +--------------------------------------------------------------------------+
+
+static int is_dirty(uint32_t word) {
+    return (dirty[word / 32] & (1U << (word % 32))) != 0;
+}
+
+/**
+ * @brief Changes a word of the cache, only a different value needs a write.
+ */
+static void update(uint32_t word, uint32_t value) {
+    if (cache[word] != value) {
+        cache[word] = value;
+        dirty[word / 32] |= 1U << (word % 32);
+    }
+}
+
+/**
+ * @brief Waits for the EEPROM to finish what it works on.
+ *
+ * @return int 0 or -1 if it refused or failed the write.
+ */
+static int wait_done(void) {
+    uint32_t done;
+
+    do {
+        done = REG_READ(EEPROM_EEDONE);
+    } while (done & EEDONE_WORKING);
+
+    return (done & (EEDONE_NOPERM | EEDONE_INVPL)) == 0 ? 0 : -1;
+}
+
+static int retry_needed(void) {
+    return (REG_READ(EEPROM_EESUPP) & (EESUPP_ERETRY | EESUPP_PRETRY)) != 0;
+}
+
+/**
+ * @brief The power-up sequence of the datasheet: the EEPROM finishes an
+ *        operation a reset interrupted before and after its own reset.
+ */
+static int power_up(void) {
+    REG_WRITE(SYSCTL_RCGCEEPROM, 1UL);
+    while ((REG_READ(SYSCTL_PREEPROM) & 1UL) == 0);
+    if (wait_done() != 0 || retry_needed()) {
+        return -1;
+    }
+
+    REG_WRITE(SYSCTL_SREEPROM, 1UL);
+    REG_WRITE(SYSCTL_SREEPROM, 0UL);
+    while ((REG_READ(SYSCTL_PREEPROM) & 1UL) == 0);
+    if (wait_done() != 0 || retry_needed()) {
+        return -1;
+    }
+
+    return (REG_READ(EEPROM_EESIZE) & EESIZE_WORDCNT_M) >= CACHE_WORDS ? 0 : -1;
+}
+
+static void seek(uint32_t word) {
+    REG_WRITE(EEPROM_EEBLOCK, word / WORDS_PER_BLOCK);
+    REG_WRITE(EEPROM_EEOFFSET, word % WORDS_PER_BLOCK);
+}
+
+/**
+ * @brief Writes count words of the cache with one seek. EERDWRINC wraps
+ *        around within a block, so the next block needs a seek of its own.
+ */
+static int write_run(uint32_t first, uint32_t count) {
+    seek(first);
+    for (uint32_t word = first; word < first + count; word++) {
+        if (word != first && word % WORDS_PER_BLOCK == 0) {
+            seek(word);
+        }
+
+        REG_WRITE(EEPROM_EERDWRINC, cache[word]);
+        if (wait_done() != 0) {
+            return -1;
+        }
+        dirty[word / 32] &= ~(1U << (word % 32));
+        stats.written_words++;
+    }
+
+    return 0;
+}
+
+static int is_record(uint32_t word) {
+    const uint32_t header = cache[word];
+    const uint32_t size = HEADER_SIZE(header);
+
+    return header != END && HEADER_KEY(header) <= TM4C_EEPROM_KEY_MAX && size > 0 &&
+           word + RECORD_WORDS(size) <= CACHE_WORDS;
+}
+
+/**
+ * @return uint32_t The word of the key's record, NONE if there is none.
+ */
+static uint32_t find(uint16_t key) {
+    for (uint32_t word = 1; word < end; word += RECORD_WORDS(HEADER_SIZE(cache[word]))) {
+        if (HEADER_KEY(cache[word]) == key) {
+            return word;
+        }
+    }
+    return NONE;
+}
+
+static uint32_t record_crc(uint32_t word) {
+    // the value follows the header in the cache, the padding is not covered
+    return tm4c_crc32(0, &cache[word], 4 + HEADER_SIZE(cache[word]));
+}
+
+int tm4c_eeprom_init(void) {
+    if (initialized) {
+        return 0;
+    }
+    if (power_up() != 0) {
+        return -EIO;
+    }
+
+    for (uint32_t word = 0; word < CACHE_WORDS; word++) {
+        if (word % WORDS_PER_BLOCK == 0) {
+            seek(word);
+        }
+        cache[word] = REG_READ(EEPROM_EERDWRINC);
+    }
+    memset(dirty, 0, sizeof(dirty));
+    commit_word = NONE;
+
+    if (cache[0] != STORE_MAGIC) {
+        // a new store becomes valid with its magic word
+        end = 1;
+        update(0, STORE_MAGIC);
+        update(1, END);
+        commit_word = 0;
+    } else {
+        for (end = 1; end < CACHE_WORDS && is_record(end); end += RECORD_WORDS(HEADER_SIZE(cache[end]))) {
+        }
+        // anything else behind the records is a leftover
+        if (end < CACHE_WORDS) {
+            update(end, END);
+        }
+    }
+
+    initialized = 1;
+    return 0;
+}
+
+int tm4c_eeprom_get(uint16_t key, void *value, size_t size) {
+    if (tm4c_eeprom_init() != 0) {
+        return -EIO;
+    }
+
+    const uint32_t word = find(key);
+    if (word == NONE) {
+        return -ENOENT;
+    }
+    if (HEADER_SIZE(cache[word]) != size) {
+        return -EINVAL;
+    }
+#if defined(TM4C_EEPROM_CRC)
+    if (cache[word + 1 + WORDS(size)] != record_crc(word)) {
+        return -EBADMSG;
+    }
+#endif
+
+    memcpy(value, &cache[word + 1], size);
+    return 0;
+}
+
+int tm4c_eeprom_set(uint16_t key, const void *value, size_t size) {
+    if (tm4c_eeprom_init() != 0) {
+        return -EIO;
+    }
+    if (key > TM4C_EEPROM_KEY_MAX || size == 0 || size > TM4C_EEPROM_CACHE) {
+        return -EINVAL;
+    }
+
+    uint32_t word = find(key);
+    if (word != NONE && HEADER_SIZE(cache[word]) != size) {
+        return -EINVAL;
+    }
+    if (word == NONE) {
+        if (end + RECORD_WORDS(size) > CACHE_WORDS) {
+            return -ENOSPC;
+        }
+
+        // the record is complete in the EEPROM before the old end word links it in
+        word = end;
+        commit_word = commit_word == NONE ? word : commit_word;
+        end += RECORD_WORDS((uint32_t)size);
+        if (end < CACHE_WORDS) {
+            update(end, END);
+        }
+        update(word, HEADER(key, size));
+    }
+
+    const uint8_t *const bytes = (const uint8_t *)value;
+    for (uint32_t i = 0; i < WORDS(size); i++) {
+        uint32_t data = 0;
+
+        memcpy(&data, bytes + 4 * i, size - 4 * i < 4 ? size - 4 * i : 4);
+        update(word + 1 + i, data);
+    }
+#if defined(TM4C_EEPROM_CRC)
+    update(word + 1 + WORDS((uint32_t)size), record_crc(word));
+#endif
+
+    return 0;
+}
+
+int tm4c_eeprom_flush(void) {
+    if (tm4c_eeprom_init() != 0) {
+        return -EIO;
+    }
+
+    const uint32_t written = stats.written_words;
+    for (uint32_t word = 0; word < CACHE_WORDS; word++) {
+        if (!is_dirty(word) || word == commit_word) {
+            continue;
+        }
+
+        uint32_t count = 1;
+        while (word + count < CACHE_WORDS && is_dirty(word + count) && word + count != commit_word) {
+            count++;
+        }
+        if (write_run(word, count) != 0) {
+            return -EIO;
+        }
+        word += count;
+    }
+
+    if (commit_word != NONE && is_dirty(commit_word) && write_run(commit_word, 1) != 0) {
+        return -EIO;
+    }
+    commit_word = NONE;
+
+    if (stats.written_words != written) {
+        stats.flushes++;
+    }
+    return (int)(stats.written_words - written);
+}
+
+int tm4c_eeprom_clear(void) {
+    if (tm4c_eeprom_init() != 0) {
+        return -EIO;
+    }
+
+    end = 1;
+    update(1, END);
+    // a new store still needs its magic word last
+    commit_word = commit_word == 0 ? 0 : NONE;
+    return 0;
+}
+
+#if defined(TM4C_EEPROM_SIMULATED)
+/**
+ * @brief Forgets the cache like a reset, the next call loads it again.
+ */
+void tm4c_eeprom_sim_reset(void) {
+    initialized = 0;
+}
+#endif
+
+tm4c_eeprom_stats_t tm4c_eeprom_stats(void) {
+    tm4c_eeprom_stats_t result = stats;
+
+    result.records = 0;
+    for (uint32_t word = 1; word < end; word += RECORD_WORDS(HEADER_SIZE(cache[word]))) {
+        result.records++;
+    }
+    result.used_bytes = 4 * end;
+    result.dirty_words = 0;
+    for (uint32_t word = 0; word < CACHE_WORDS; word++) {
+        result.dirty_words += (uint32_t)is_dirty(word);
+    }
+
+    return result;
+}
@@ -0,0 +1,176 @@
+/**
+ * @file fault.c
+ * @author Esteban Duran (@astroesteban)
+ * @brief Captures a crash record on any fault and resets the chip.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @ref https://interrupt.memfault.com/blog/cortex-m-hardfault-debug
+ *
+ * @copyright Apache License
+ *
+ */
+#include "tm4c_fault.h"
+
+#include <stddef.h>
+
+#include "tm4c_crc.h"
+#include "tm4c_sections.h"
+
+// +--------------------------------------------------------------------------+
+// +			        Type Definitions and Macros                           +
+// +--------------------------------------------------------------------------+
+#define SCB_CFSR    (*((volatile uint32_t *)0xE000ED28)) // Configurable Fault Status
+#define SCB_HFSR    (*((volatile uint32_t *)0xE000ED2C)) // HardFault Status
+#define SCB_MMFAR   (*((volatile uint32_t *)0xE000ED34)) // MemManage Fault Address
+#define SCB_BFAR    (*((volatile uint32_t *)0xE000ED38)) // BusFault Address
+#define SCB_AIRCR   (*((volatile uint32_t *)0xE000ED0C)) // Application Interrupt and Reset Control
+#define DBG_DHCSR   (*((volatile uint32_t *)0xE000EDF0)) // Debug Halting Control and Status
+
+#define SCB_AIRCR_VECTKEY       (0x05FAUL << 16)
+#define SCB_AIRCR_SYSRESETREQ   (1UL << 2)
+#define DBG_DHCSR_C_DEBUGEN     (1UL << 0)          // a debugger is attached
+
+#define EXC_RETURN_STD_FRAME    (1UL << 4)          // no FP registers stacked
+#define XPSR_STACK_ALIGN        (1UL << 9)          // the core padded the frame
+
+#define FRAME_WORDS             8                   // r0-r3, r12, lr, pc, xpsr
+#define FRAME_WORDS_FP          26                  // + s0-s15, fpscr, reserved
+
+#define SRAM_START              0x20000000UL
+
+/* Size of the stack the capture runs on, the faulting stack may be gone */
+#define FAULT_STACK_BYTES       256
+#define FAULT_STACK_BYTES_STR   TM4C_STRINGIFY(FAULT_STACK_BYTES)
+
+
+// +--------------------------------------------------------------------------+
+// +					External Variables declaration					      +
+// +--------------------------------------------------------------------------+
+//top of the stack, i.e. the end of SRAM
+extern uint32_t _stack_ptr;
+
+
+// +--------------------------------------------------------------------------+
+// +					Global Variables definition	    				      +
+// +--------------------------------------------------------------------------+
+
+// * named so that utils/decode_crash.py can find it in the ELF
+TM4C_PERSISTENT tm4c_crash_record_t tm4c_crash_record;
+
+// * only referenced from the naked fault entry below
+TM4C_NOINIT __attribute__((used, aligned(8)))
+uint8_t tm4c_fault_stack[FAULT_STACK_BYTES];
+
+
+// +--------------------------------------------------------------------------+
+// +                          Function Definitions                            +
+// +--------------------------------------------------------------------------+
+void tm4c_fault_capture(const uint32_t *frame, uint32_t exc_return)
+    __attribute__((noreturn, used));
+
+/**
+ * @brief The common entry of every fault. Hands the exception frame of the
+ *        stack that was active and EXC_RETURN to tm4c_fault_capture() and
+ *        moves to a dedicated stack, so a stack overflow can still be
+ *        captured.
+ */
+__attribute__((naked)) void tm4c_fault_entry(void) {
+    __asm volatile (
+        "   tst   lr, #4                                          \n\t"
+        "   ite   eq                                              \n\t"
+        "   mrseq r0, msp                                         \n\t"
+        "   mrsne r0, psp                                         \n\t"
+        "   mov   r1, lr                                          \n\t"
+        "   ldr   r2, =tm4c_fault_stack + " FAULT_STACK_BYTES_STR "\n\t"
+        "   msr   msp, r2                                         \n\t"
+        "   b     tm4c_fault_capture                              \n\t"
+        "   .ltorg                                                \n\t");
+}
+
+/**
+ * @brief Whether the word range lies in SRAM and can be read without
+ *        causing another fault (which would lock the core up).
+ */
+static int readable(uint32_t address, uint32_t words) {
+    return (address & 3) == 0 && address >= SRAM_START &&
+           address <= (uint32_t)&_stack_ptr - words * 4;
+}
+
+void tm4c_fault_capture(const uint32_t *frame, uint32_t exc_return) {
+    tm4c_crash_record_t *const record = &tm4c_crash_record;
+    const uint32_t address = (uint32_t)frame;
+    uint32_t ipsr;
+
+    __asm volatile ("mrs %0, ipsr" : "=r" (ipsr));
+
+    record->magic = TM4C_CRASH_MAGIC;
+    record->version = TM4C_CRASH_VERSION;
+    record->count++;
+    record->vector = ipsr & 0x1FF;
+    record->exc_return = exc_return;
+    record->cfsr = SCB_CFSR;
+    record->hfsr = SCB_HFSR;
+    record->mmfar = SCB_MMFAR;
+    record->bfar = SCB_BFAR;
+
+    if (readable(address, FRAME_WORDS)) {
+        record->r0 = frame[0];
+        record->r1 = frame[1];
+        record->r2 = frame[2];
+        record->r3 = frame[3];
+        record->r12 = frame[4];
+        record->lr = frame[5];
+        record->pc = frame[6];
+        record->xpsr = frame[7];
+
+        // undo what the core pushed to get the stack pointer of the code
+        // that faulted
+        record->sp = address + 4 * ((exc_return & EXC_RETURN_STD_FRAME) ? FRAME_WORDS : FRAME_WORDS_FP);
+        if (record->xpsr & XPSR_STACK_ALIGN) {
+            record->sp += 4;
+        }
+    } else {
+        record->r0 = record->r1 = record->r2 = record->r3 = 0;
+        record->r12 = record->lr = record->pc = record->xpsr = 0;
+        record->sp = address;
+    }
+
+    for (uint32_t i = 0; i < TM4C_CRASH_STACK_WORDS; i++) {
+        const uint32_t word = record->sp + 4 * i;
+        record->stack[i] = readable(word, 1) ? *(const uint32_t *)word : 0;
+    }
+
+    record->crc = tm4c_crc32(0, record, offsetof(tm4c_crash_record_t, crc));
+
+    // everything has to be in SRAM before we pull the reset
+    __asm volatile ("dsb" ::: "memory");
+
+    if (DBG_DHCSR & DBG_DHCSR_C_DEBUGEN) {
+        __asm volatile ("bkpt #0");
+    }
+
+    SCB_AIRCR = SCB_AIRCR_VECTKEY | SCB_AIRCR_SYSRESETREQ;
+    __asm volatile ("dsb" ::: "memory");
+
+    while (1);
+}
+
+const tm4c_crash_record_t *tm4c_crash_record_get(void) {
+    const tm4c_crash_record_t *const record = &tm4c_crash_record;
+
+    if (record->magic != TM4C_CRASH_MAGIC || record->version != TM4C_CRASH_VERSION ||
+        record->crc != tm4c_crc32(0, record, offsetof(tm4c_crash_record_t, crc))) {
+        return NULL;
+    }
+
+    return record;
+}
+
+void tm4c_crash_record_clear(void) {
+    tm4c_crash_record.magic = 0;
+}
+
+uint32_t tm4c_crash_count(void) {
+    return tm4c_crash_record.count;
+}
@@ -0,0 +1,1020 @@
+/**
+ * @file fs.c
+ * @author Esteban Duran (@astroesteban)
+ * @brief The log-structured flash filesystem described in tm4c_fs.h.
+ *
+ * @details Every block starts with a header of four words: a magic number,
+ *          the erase count, the position of the block in the log and its
+ *          complement. The last two are left erased while the block is free.
+ *
+ *          A record is a tag (type, file id and payload length), the
+ *          generation of the file it belongs to, the offset of its data in
+ *          the file, the CRC-32 of all that and the payload, and the payload
+ *          padded to whole words. Which records are still in use follows from
+ *          the generations alone, not from their order in the log, so the
+ *          garbage collector can move them freely:
+ *
+ *          - a create record while it is the latest one of its file,
+ *          - data records of the current generation of their file,
+ *          - a delete record while its file id is not taken again.
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @ref TM4C123GH6PM datasheet section 8.2.3 (Flash Memory Programming)
+ *
+ * @copyright Apache License
+ *
+ */
+#include "tm4c_fs.h"
+
+#include <assert.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdbool.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "tm4c_crc.h"
+
+// +--------------------------------------------------------------------------+
+// +			        Type Definitions and Macros                           +
+// +--------------------------------------------------------------------------+
+
+static_assert(TM4C_FS_SIZE % TM4C_FS_BLOCK_SIZE == 0, "TM4C_FS_SIZE must be a multiple of 1 KB");
+// the newest block, one more and the two new_head() keeps free
+static_assert(TM4C_FS_BLOCKS >= 4, "The filesystem needs at least 4 KB");
+static_assert(TM4C_FS_BLOCKS <= 256, "The log order is kept in bytes");
+static_assert(TM4C_FS_MAX_FILES < 256, "File ids have 8 bits, 0 is not used");
+
+/*
+ * The host tests (test/host) build this file against flash simulated in
+ * RAM, erasing and programming go through the hooks there.
+ */
+#if defined(TM4C_FS_SIMULATED)
+const uint32_t *tm4c_fs_sim_region(void);
+int tm4c_fs_sim_erase(uint32_t offset);
+int tm4c_fs_sim_program(uint32_t offset, const uint32_t *words, uint32_t count);
+
+#define REGION() tm4c_fs_sim_region()
+#define FLASH_ERASE(offset) tm4c_fs_sim_erase(offset)
+#define FLASH_PROGRAM(offset, words, count) tm4c_fs_sim_program(offset, words, count)
+#else
+#define FLASH_FMA       (*((volatile uint32_t *)0x400FD000))    // Flash Memory Address
+#define FLASH_FMD       (*((volatile uint32_t *)0x400FD004))    // Flash Memory Data
+#define FLASH_FMC       (*((volatile uint32_t *)0x400FD008))    // Flash Memory Control
+#define FLASH_FCRIS     (*((volatile uint32_t *)0x400FD00C))    // Raw Interrupt Status
+#define FLASH_FCMISC    (*((volatile uint32_t *)0x400FD014))    // Masked Interrupt Status and Clear
+#define FLASH_FMC2      (*((volatile uint32_t *)0x400FD020))    // Flash Memory Control 2
+#define FLASH_FWB(n)    (*((volatile uint32_t *)(0x400FD100 + 4 * (n)))) // Write Buffer
+#define SYSCTL_BOOTCFG  (*((volatile uint32_t *)0x400FE1D0))    // Boot Configuration
+
+#define FMC_WRITE       (1UL << 0)
+#define FMC_ERASE       (1UL << 1)
+#define FMC2_WRBUF      (1UL << 0)
+#define BOOTCFG_KEY     (1UL << 4)          // which key FMC and FMC2 take
+
+// access, voltage, invalid data, erase verify and program verify errors
+#define FCRIS_ERRORS    ((1UL << 0) | (1UL << 9) | (1UL << 10) | (1UL << 11) | (1UL << 13))
+
+#define FLASH_ROW       128U                // bytes the write buffer covers
+
+/* Start of the region, defined in tm4c123gh6pm.ld */
+extern const uint32_t __fs_start[];
+
+static int flash_erase(uint32_t offset);
+static int flash_program(uint32_t offset, const uint32_t *words, uint32_t count);
+
+#define REGION() __fs_start
+#define FLASH_ERASE(offset) flash_erase(offset)
+#define FLASH_PROGRAM(offset, words, count) flash_program(offset, words, count)
+#endif
+
+#define BLOCK_MAGIC     0x31534654UL        // "TFS1"
+#define BLOCK_HEADER    16U                 // magic, erase count, sequence, ~sequence
+#define RECORD_HEADER   16U                 // tag, generation, offset, CRC
+#define MAX_PAYLOAD     (TM4C_FS_BLOCK_SIZE - BLOCK_HEADER - RECORD_HEADER)
+#define MIN_FRAGMENT    64U                 // smaller pieces of a write start a new block
+#define ERASED          0xFFFFFFFFUL
+#define DIRTY           0xFFFFFFFFUL        // sequence of a block that has to be erased
+
+#define RECORD_CREATE   0x01U               // payload: the name
+#define RECORD_DATA     0x02U
+#define RECORD_DELETE   0x03U
+
+#define TAG(type, id, length) (((uint32_t)(type) << 24) | ((uint32_t)(id) << 16) | (uint32_t)(length))
+#define TAG_TYPE(tag)   ((tag) >> 24)
+#define TAG_ID(tag)     (((tag) >> 16) & 0xFFU)
+#define TAG_LENGTH(tag) ((tag) & 0xFFFFU)
+
+#define WORDS(bytes)    (((bytes) + 3U) / 4U)
+#define WORD(offset)    (REGION()[(offset) / 4U])
+
+typedef struct {
+    uint32_t sequence;              // position in the log, 0 while free
+    uint32_t erase_count;
+} block_t;
+
+typedef struct {
+    uint32_t generation;            // of the latest create or delete record
+    uint32_t create;                // offset of the create record, 0 if there is no file
+    uint32_t size;
+} file_t;
+
+typedef struct {
+    uint32_t id;                    // 0 while closed
+    uint32_t position;
+    int flags;
+} handle_t;
+
+
+// +--------------------------------------------------------------------------+
+// +					Global Variables definition	    				      +
+// +--------------------------------------------------------------------------+
+
+static bool mounted;
+static bool collecting;             // the collector may take the last free block
+static block_t blocks[TM4C_FS_BLOCKS];
+static uint8_t order[TM4C_FS_BLOCKS];   // the log, oldest block first
+static uint32_t log_blocks;
+static uint32_t head_offset;        // where the next record goes in the newest block
+static uint32_t next_sequence;
+static uint32_t next_generation;
+static file_t files[TM4C_FS_MAX_FILES];
+static handle_t handles[TM4C_FS_MAX_OPEN];
+
+/* A file being copied into a new generation, its records are in use too */
+static uint32_t pending_id;
+static uint32_t pending_generation;
+
+
+// +--------------------------------------------------------------------------+
+// +                          Function Definitions                            +
+// +--------------------------------------------------------------------------+
+#if !defined(TM4C_FS_SIMULATED)
+static uint32_t flash_key(void) {
+    return (SYSCTL_BOOTCFG & BOOTCFG_KEY) ? 0xA4420000UL : 0x71D50000UL;
+}
+
+static int flash_result(void) {
+    const uint32_t errors = FLASH_FCRIS & FCRIS_ERRORS;
+
+    FLASH_FCMISC = errors;
+    return errors == 0 ? 0 : -1;
+}
+
+static int flash_erase(uint32_t offset) {
+    FLASH_FCMISC = FCRIS_ERRORS;
+    FLASH_FMA = (uint32_t)__fs_start + offset;
+    FLASH_FMC = flash_key() | FMC_ERASE;
+    while (FLASH_FMC & FMC_ERASE);
+
+    return flash_result();
+}
+
+/* Single words are programmed directly, more through the 32 word buffer */
+static int flash_program(uint32_t offset, const uint32_t *words, uint32_t count) {
+    uint32_t address = (uint32_t)__fs_start + offset;
+
+    FLASH_FCMISC = FCRIS_ERRORS;
+    while (count > 0) {
+        const uint32_t row = address & ~(FLASH_ROW - 1);
+        uint32_t n = (row + FLASH_ROW - address) / 4;
+
+        n = n < count ? n : count;
+        if (n == 1) {
+            FLASH_FMA = address;
+            FLASH_FMD = words[0];
+            FLASH_FMC = flash_key() | FMC_WRITE;
+            while (FLASH_FMC & FMC_WRITE);
+        } else {
+            FLASH_FMA = row;
+            for (uint32_t i = 0; i < n; i++) {
+                FLASH_FWB((address - row) / 4 + i) = words[i];
+            }
+            FLASH_FMC2 = flash_key() | FMC2_WRBUF;
+            while (FLASH_FMC2 & FMC2_WRBUF);
+        }
+
+        if (flash_result() != 0) {
+            return -1;
+        }
+        address += n * 4;
+        words += n;
+        count -= n;
+    }
+
+    return 0;
+}
+#endif
+
+static uint32_t block_start(uint32_t block) {
+    return block * TM4C_FS_BLOCK_SIZE;
+}
+
+static uint32_t head_block(void) {
+    return order[log_blocks - 1];
+}
+
+static uint32_t record_end(uint32_t offset) {
+    return offset + RECORD_HEADER + WORDS(TAG_LENGTH(WORD(offset))) * 4;
+}
+
+/**
+ * @brief Whether a record that fits before end starts at offset. Says
+ *        nothing about whether it was written completely.
+ */
+static bool is_record(uint32_t offset, uint32_t end) {
+    if (offset + RECORD_HEADER > end) {
+        return false;
+    }
+
+    const uint32_t tag = WORD(offset);
+    const uint32_t type = TAG_TYPE(tag);
+    const uint32_t id = TAG_ID(tag);
+
+    return type >= RECORD_CREATE && type <= RECORD_DELETE && id >= 1 &&
+           id <= TM4C_FS_MAX_FILES && TAG_LENGTH(tag) <= MAX_PAYLOAD && record_end(offset) <= end;
+}
+
+/**
+ * @brief Whether the record was written completely.
+ */
+static bool is_committed(uint32_t offset) {
+    const uint8_t *const record = (const uint8_t *)REGION() + offset;
+    const uint32_t crc = tm4c_crc32(tm4c_crc32(0, record, 12), record + RECORD_HEADER,
+                                    TAG_LENGTH(WORD(offset)));
+
+    return crc == WORD(offset + 12);
+}
+
+/**
+ * @brief Steps through the records of the log, oldest first. Start with
+ *        index 0 and offset 0.
+ *
+ * @return uint32_t The offset of the next record, 0 at the end of the log.
+ */
+static uint32_t next_record(uint32_t *index, uint32_t offset) {
+    if (*index >= log_blocks) {
+        return 0;
+    }
+
+    offset = offset == 0 ? block_start(order[*index]) + BLOCK_HEADER : record_end(offset);
+    for (;;) {
+        if (is_record(offset, block_start(order[*index]) + TM4C_FS_BLOCK_SIZE)) {
+            return offset;
+        }
+        if (++*index >= log_blocks) {
+            return 0;
+        }
+        offset = block_start(order[*index]) + BLOCK_HEADER;
+    }
+}
+
+static bool is_live(uint32_t offset) {
+    const uint32_t tag = WORD(offset);
+    const uint32_t generation = WORD(offset + 4);
+    const file_t *const file = &files[TAG_ID(tag) - 1];
+
+    switch (TAG_TYPE(tag)) {
+    case RECORD_CREATE:
+        return file->create == offset;
+    case RECORD_DELETE:
+        return file->create == 0 && file->generation == generation;
+    default:
+        return (file->create != 0 && file->generation == generation) ||
+               (TAG_ID(tag) == pending_id && generation == pending_generation);
+    }
+}
+
+static uint32_t free_blocks(void) {
+    uint32_t count = 0;
+
+    for (uint32_t block = 0; block < TM4C_FS_BLOCKS; block++) {
+        count += blocks[block].sequence == 0 ? 1 : 0;
+    }
+    return count;
+}
+
+/**
+ * @brief Payload the newest block can still take in one record.
+ */
+static uint32_t head_room(void) {
+    if (log_blocks == 0 || head_offset + RECORD_HEADER >= TM4C_FS_BLOCK_SIZE) {
+        return 0;
+    }
+    return (TM4C_FS_BLOCK_SIZE - head_offset - RECORD_HEADER) & ~3U;
+}
+
+/**
+ * @brief Bytes of the block taken by records in use.
+ */
+static uint32_t live_bytes(uint32_t block) {
+    const uint32_t end = block_start(block) + TM4C_FS_BLOCK_SIZE;
+    uint32_t bytes = 0;
+
+    for (uint32_t offset = block_start(block) + BLOCK_HEADER; is_record(offset, end);
+         offset = record_end(offset)) {
+        bytes += is_live(offset) ? record_end(offset) - offset : 0;
+    }
+    return bytes;
+}
+
+/**
+ * @brief Any flash error leaves the state in RAM in doubt, the next
+ *        operation mounts again.
+ */
+static int flash_failed(void) {
+    mounted = false;
+    return -EIO;
+}
+
+/**
+ * @brief Erases a block and writes its header as a free block.
+ */
+static int erase_block(uint32_t block, uint32_t erase_count) {
+    const uint32_t header[2] = {BLOCK_MAGIC, erase_count};
+
+    if (FLASH_ERASE(block_start(block)) != 0 || FLASH_PROGRAM(block_start(block), header, 2) != 0) {
+        return flash_failed();
+    }
+
+    blocks[block].sequence = 0;
+    blocks[block].erase_count = erase_count;
+    return 0;
+}
+
+static int collect(uint32_t block);
+
+/**
+ * @brief Starts a new block at the end of the log: the free one erased the
+ *        fewest times. Garbage is collected first until more than keep
+ *        blocks are free. Writes keep one block for the collector and one
+ *        for deleting and truncating files, which is how a full filesystem
+ *        gets space back.
+ */
+static int new_head(uint32_t keep) {
+    for (uint32_t attempts = 0; !collecting && free_blocks() <= keep; attempts++) {
+        // compacting every other block would not free one either
+        uint32_t garbage = 0;
+
+        for (uint32_t i = 0; i + 1 < log_blocks; i++) {
+            garbage += TM4C_FS_BLOCK_SIZE - BLOCK_HEADER - live_bytes(order[i]);
+        }
+        if (garbage < TM4C_FS_BLOCK_SIZE - BLOCK_HEADER || attempts >= TM4C_FS_BLOCKS) {
+            return -ENOSPC;
+        }
+
+        const int error = collect(order[0]);
+        if (error != 0) {
+            return error;
+        }
+    }
+
+    uint32_t chosen = TM4C_FS_BLOCKS;
+    for (uint32_t block = 0; block < TM4C_FS_BLOCKS; block++) {
+        if (blocks[block].sequence == 0 &&
+            (chosen == TM4C_FS_BLOCKS || blocks[block].erase_count < blocks[chosen].erase_count)) {
+            chosen = block;
+        }
+    }
+    if (chosen == TM4C_FS_BLOCKS) {
+        return -ENOSPC;
+    }
+
+    const uint32_t sequence[2] = {next_sequence, ~next_sequence};
+    if (FLASH_PROGRAM(block_start(chosen) + 8, sequence, 2) != 0) {
+        return flash_failed();
+    }
+
+    blocks[chosen].sequence = next_sequence++;
+    order[log_blocks++] = (uint8_t)chosen;
+    head_offset = BLOCK_HEADER;
+    return 0;
+}
+
+/**
+ * @brief Appends a record to the log, in a new block if it does not fit.
+ *        The CRC is programmed last, it commits the record.
+ *
+ * @return int The offset of the record or a negative errno value.
+ */
+static int append(uint32_t type, uint32_t id, uint32_t generation, uint32_t position,
+                  const void *payload, uint32_t length) {
+    const uint32_t size = RECORD_HEADER + WORDS(length) * 4;
+    // a create record for a file that exists outside a rewrite truncates it
+    const bool frees = type == RECORD_DELETE ||
+                       (type == RECORD_CREATE && files[id - 1].create != 0 && pending_id == 0);
+
+    if (log_blocks == 0 || head_offset + size > TM4C_FS_BLOCK_SIZE) {
+        const int error = new_head(frees ? 1 : 2);
+        if (error != 0) {
+            return error;
+        }
+    }
+
+    const uint32_t offset = block_start(head_block()) + head_offset;
+    const uint32_t header[3] = {TAG(type, id, length), generation, position};
+    const uint32_t crc = tm4c_crc32(tm4c_crc32(0, header, sizeof(header)), payload, length);
+
+    head_offset += size;
+    if (FLASH_PROGRAM(offset, header, 3) != 0) {
+        return flash_failed();
+    }
+
+    // the payload goes through a buffer that pads the last word with ones
+    uint32_t words[32];
+    for (uint32_t done = 0; done < length; done += sizeof(words)) {
+        const uint32_t chunk = length - done < sizeof(words) ? length - done : sizeof(words);
+
+        memset(words, 0xFF, sizeof(words));
+        memcpy(words, (const uint8_t *)payload + done, chunk);
+        if (FLASH_PROGRAM(offset + RECORD_HEADER + done, words, WORDS(chunk)) != 0) {
+            return flash_failed();
+        }
+    }
+
+    if (FLASH_PROGRAM(offset + 12, &crc, 1) != 0) {
+        return flash_failed();
+    }
+    return (int)offset;
+}
+
+/**
+ * @brief Copies the records in use out of the block and erases it. Records
+ *        that were not written completely are dropped.
+ */
+static int collect(uint32_t block) {
+    const uint32_t end = block_start(block) + TM4C_FS_BLOCK_SIZE;
+    int error = 0;
+
+    collecting = true;
+    if (block == head_block()) {
+        error = new_head(0);
+    }
+
+    for (uint32_t offset = block_start(block) + BLOCK_HEADER; error == 0 && is_record(offset, end);
+         offset = record_end(offset)) {
+        if (!is_committed(offset) || !is_live(offset)) {
+            continue;
+        }
+
+        const uint32_t tag = WORD(offset);
+        const int copy = append(TAG_TYPE(tag), TAG_ID(tag), WORD(offset + 4), WORD(offset + 8),
+                                (const uint8_t *)REGION() + offset + RECORD_HEADER, TAG_LENGTH(tag));
+        if (copy < 0) {
+            error = copy;
+        } else if (TAG_TYPE(tag) == RECORD_CREATE) {
+            files[TAG_ID(tag) - 1].create = (uint32_t)copy;
+        }
+    }
+    collecting = false;
+
+    if (error != 0) {
+        return error;
+    }
+
+    // the block leaves the log before it is erased
+    for (uint32_t i = 0, j = 0; i < log_blocks; i++) {
+        if (order[i] != block) {
+            order[j++] = order[i];
+        }
+    }
+    log_blocks--;
+
+    return erase_block(block, blocks[block].erase_count + 1);
+}
+
+/**
+ * @brief Reads a range of a file, the parts no record covers read as zeros.
+ */
+static void read_range(uint32_t id, uint32_t generation, uint32_t position, uint8_t *data,
+                       uint32_t size) {
+    uint32_t index = 0;
+
+    memset(data, 0, size);
+    for (uint32_t offset = next_record(&index, 0); offset != 0; offset = next_record(&index, offset)) {
+        const uint32_t tag = WORD(offset);
+
+        if (TAG_TYPE(tag) != RECORD_DATA || TAG_ID(tag) != id || WORD(offset + 4) != generation) {
+            continue;
+        }
+
+        const uint32_t start = WORD(offset + 8);
+        const uint32_t end = start + TAG_LENGTH(tag);
+        const uint32_t from = start > position ? start : position;
+        const uint32_t to = end < position + size ? end : position + size;
+
+        if (from < to) {
+            memcpy(data + (from - position),
+                   (const uint8_t *)REGION() + offset + RECORD_HEADER + (from - start), to - from);
+        }
+    }
+}
+
+/**
+ * @brief Appends data records, filling the newest block before a new one
+ *        is started.
+ *
+ * @return int The number of bytes written or a negative errno value if not
+ *         even one could be.
+ */
+static int write_data(uint32_t id, uint32_t generation, uint32_t position, const uint8_t *data,
+                      uint32_t size) {
+    uint32_t written = 0;
+
+    while (written < size) {
+        const uint32_t remaining = size - written;
+        uint32_t room = head_room();
+
+        if (room < remaining && room < MIN_FRAGMENT) {
+            room = MAX_PAYLOAD;
+        }
+
+        const uint32_t chunk = remaining < room ? remaining : room;
+        const int result = append(RECORD_DATA, id, generation, position + written, data + written, chunk);
+        if (result < 0) {
+            return written > 0 ? (int)written : result;
+        }
+        written += chunk;
+    }
+
+    return (int)written;
+}
+
+/**
+ * @brief Gives the file a new generation without data (truncates it), or
+ *        commits the data already written for generation.
+ */
+static int commit(uint32_t id, uint32_t generation, uint32_t size) {
+    file_t *const file = &files[id - 1];
+    char name[TM4C_FS_NAME_MAX];
+    const uint32_t length = TAG_LENGTH(WORD(file->create));
+
+    // the collector may move the old create record while the new one is written
+    memcpy(name, (const uint8_t *)REGION() + file->create + RECORD_HEADER, length);
+
+    const int offset = append(RECORD_CREATE, id, generation, 0, name, length);
+    if (offset < 0) {
+        return offset;
+    }
+
+    file->generation = generation;
+    file->create = (uint32_t)offset;
+    file->size = size;
+    return 0;
+}
+
+/**
+ * @brief Writes in front of the end of a file: the whole file is copied
+ *        into a new generation with the data in place, which only replaces
+ *        the file once it is committed.
+ */
+static int rewrite(uint32_t id, uint32_t position, const uint8_t *data, uint32_t size) {
+    const file_t *const file = &files[id - 1];
+    const uint32_t generation = next_generation++;
+    const uint32_t new_size = position + size > file->size ? position + size : file->size;
+    uint8_t buffer[256];
+    int error = 0;
+
+    pending_id = id;
+    pending_generation = generation;
+
+    for (uint32_t at = 0; at < new_size && error == 0; at += sizeof(buffer)) {
+        const uint32_t chunk = new_size - at < sizeof(buffer) ? new_size - at : sizeof(buffer);
+        const uint32_t from = position > at ? position : at;
+        const uint32_t to = position + size < at + chunk ? position + size : at + chunk;
+
+        read_range(id, file->generation, at, buffer, chunk);
+        if (from < to) {
+            memcpy(buffer + (from - at), data + (from - position), to - from);
+        }
+
+        const int written = write_data(id, generation, at, buffer, chunk);
+        error = written < 0 ? written : (uint32_t)written < chunk ? -ENOSPC : 0;
+    }
+
+    if (error == 0) {
+        error = commit(id, generation, new_size);
+    }
+
+    pending_id = 0;
+    return error < 0 ? error : (int)size;
+}
+
+/**
+ * @brief Applies a create or delete record found while mounting.
+ */
+static void replay(uint32_t offset) {
+    const uint32_t tag = WORD(offset);
+    const uint32_t generation = WORD(offset + 4);
+    file_t *const file = &files[TAG_ID(tag) - 1];
+
+    if (generation >= next_generation) {
+        next_generation = generation + 1;
+    }
+    if (TAG_TYPE(tag) == RECORD_DATA || generation < file->generation) {
+        return;
+    }
+
+    file->generation = generation;
+    file->create = TAG_TYPE(tag) == RECORD_CREATE ? offset : 0;
+}
+
+static bool is_blank(uint32_t block) {
+    for (uint32_t offset = block_start(block); offset < block_start(block) + TM4C_FS_BLOCK_SIZE;
+         offset += 4) {
+        if (WORD(offset) != ERASED) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static int mount(void) {
+    uint32_t max_erase_count = 0;
+    uint32_t repair = TM4C_FS_BLOCKS;
+
+    mounted = false;
+    collecting = false;
+    log_blocks = 0;
+    head_offset = TM4C_FS_BLOCK_SIZE;
+    next_sequence = 1;
+    next_generation = 1;
+    pending_id = 0;
+    memset(files, 0, sizeof(files));
+
+    for (uint32_t block = 0; block < TM4C_FS_BLOCKS; block++) {
+        const uint32_t *const header = &WORD(block_start(block));
+
+        const bool formatted = header[0] == BLOCK_MAGIC && header[1] != ERASED;
+
+        blocks[block].erase_count = header[1];
+        if (formatted && header[2] == ERASED && header[3] == ERASED) {
+            blocks[block].sequence = 0;
+        } else if (formatted && header[3] == ~header[2] && header[2] != 0 && header[2] != DIRTY) {
+            blocks[block].sequence = header[2];
+            order[log_blocks++] = (uint8_t)block;
+        } else {
+            // torn erase or header, or not formatted yet
+            blocks[block].sequence = DIRTY;
+            continue;
+        }
+        max_erase_count = blocks[block].erase_count > max_erase_count ? blocks[block].erase_count
+                                                                      : max_erase_count;
+    }
+
+    for (uint32_t block = 0; block < TM4C_FS_BLOCKS; block++) {
+        if (blocks[block].sequence != DIRTY) {
+            continue;
+        }
+        // the erase count was lost with the header, assume the worst
+        const uint32_t header[2] = {BLOCK_MAGIC, max_erase_count};
+        const int error = is_blank(block)
+            ? (FLASH_PROGRAM(block_start(block), header, 2) == 0 ? 0 : flash_failed())
+            : erase_block(block, max_erase_count);
+        if (error != 0) {
+            return error;
+        }
+        blocks[block].sequence = 0;
+        blocks[block].erase_count = max_erase_count;
+    }
+
+    // oldest first
+    for (uint32_t i = 1; i < log_blocks; i++) {
+        const uint8_t block = order[i];
+        uint32_t j = i;
+
+        for (; j > 0 && blocks[order[j - 1]].sequence > blocks[block].sequence; j--) {
+            order[j] = order[j - 1];
+        }
+        order[j] = block;
+    }
+    if (log_blocks > 0) {
+        next_sequence = blocks[head_block()].sequence + 1;
+    }
+
+    for (uint32_t i = 0; i < log_blocks; i++) {
+        const uint32_t start = block_start(order[i]);
+        const uint32_t end = start + TM4C_FS_BLOCK_SIZE;
+        uint32_t offset = start + BLOCK_HEADER;
+
+        for (; is_record(offset, end); offset = record_end(offset)) {
+            if (is_committed(offset)) {
+                replay(offset);
+            } else {
+                repair = order[i];
+            }
+        }
+
+        // behind the records the newest block is erased, unless a reset
+        // cut a tag short, then nothing more goes into it
+        if (i == log_blocks - 1) {
+            head_offset = offset < end && WORD(offset) == ERASED ? offset - start : TM4C_FS_BLOCK_SIZE;
+        }
+    }
+
+    mounted = true;
+
+    int error = log_blocks == 0 ? new_head(0) : 0;
+    if (error == 0 && repair != TM4C_FS_BLOCKS) {
+        error = collect(repair);
+    }
+    if (error != 0) {
+        return error;
+    }
+
+    // no partly written records are left, so sizes can trust every record
+    uint32_t index = 0;
+    for (uint32_t offset = next_record(&index, 0); offset != 0; offset = next_record(&index, offset)) {
+        const uint32_t tag = WORD(offset);
+        file_t *const file = &files[TAG_ID(tag) - 1];
+        const uint32_t end = WORD(offset + 8) + TAG_LENGTH(tag);
+
+        if (TAG_TYPE(tag) == RECORD_DATA && is_live(offset) && end > file->size) {
+            file->size = end;
+        }
+    }
+
+    return 0;
+}
+
+static int ensure_mounted(void) {
+    return mounted ? 0 : mount();
+}
+
+/**
+ * @return uint32_t The id of the file with the name, 0 if there is none.
+ */
+static uint32_t find(const char *name, size_t length) {
+    for (uint32_t id = 1; id <= TM4C_FS_MAX_FILES; id++) {
+        const file_t *const file = &files[id - 1];
+
+        if (file->create != 0 && TAG_LENGTH(WORD(file->create)) == length &&
+            memcmp((const uint8_t *)REGION() + file->create + RECORD_HEADER, name, length) == 0) {
+            return id;
+        }
+    }
+    return 0;
+}
+
+static handle_t *handle_of(int fd) {
+    const int index = fd - TM4C_FS_FD_FIRST;
+
+    if (!mounted || index < 0 || index >= TM4C_FS_MAX_OPEN || handles[index].id == 0 ||
+        files[handles[index].id - 1].create == 0) {
+        return NULL;
+    }
+    return &handles[index];
+}
+
+static void fill_stat(const file_t *file, struct stat *st) {
+    memset(st, 0, sizeof(*st));
+    st->st_mode = S_IFREG | 0666;
+    st->st_nlink = 1;
+    st->st_size = (off_t)file->size;
+    st->st_blksize = MAX_PAYLOAD;
+    st->st_blocks = (blkcnt_t)((file->size + 511) / 512);
+}
+
+int tm4c_fs_mount(void) {
+    memset(handles, 0, sizeof(handles));
+    return mount();
+}
+
+int tm4c_fs_format(void) {
+    const int error = ensure_mounted();
+    if (error != 0) {
+        return error;
+    }
+
+    memset(handles, 0, sizeof(handles));
+    for (uint32_t block = 0; block < TM4C_FS_BLOCKS; block++) {
+        if (blocks[block].sequence != 0) {
+            const int erased = erase_block(block, blocks[block].erase_count + 1);
+            if (erased != 0) {
+                return erased;
+            }
+        }
+    }
+
+    return mount();
+}
+
+int tm4c_fs_open(const char *name, int flags) {
+    const size_t length = strlen(name);
+    int error = ensure_mounted();
+
+    if (error != 0) {
+        return error;
+    }
+    if (length == 0) {
+        return -ENOENT;
+    }
+    if (length > TM4C_FS_NAME_MAX) {
+        return -ENAMETOOLONG;
+    }
+
+    uint32_t slot = 0;
+    while (slot < TM4C_FS_MAX_OPEN && handles[slot].id != 0) {
+        slot++;
+    }
+    if (slot == TM4C_FS_MAX_OPEN) {
+        return -EMFILE;
+    }
+
+    const bool writable = (flags & O_ACCMODE) != O_RDONLY;
+    uint32_t id = find(name, length);
+
+    if (id == 0) {
+        if ((flags & O_CREAT) == 0) {
+            return -ENOENT;
+        }
+
+        id = 1;
+        while (id <= TM4C_FS_MAX_FILES && files[id - 1].create != 0) {
+            id++;
+        }
+        if (id > TM4C_FS_MAX_FILES) {
+            return -ENOSPC;
+        }
+
+        const uint32_t generation = next_generation++;
+        const int offset = append(RECORD_CREATE, id, generation, 0, name, (uint32_t)length);
+        if (offset < 0) {
+            return offset;
+        }
+        files[id - 1] = (file_t){.generation = generation, .create = (uint32_t)offset, .size = 0};
+    } else if ((flags & (O_CREAT | O_EXCL)) == (O_CREAT | O_EXCL)) {
+        return -EEXIST;
+    } else if ((flags & O_TRUNC) != 0 && writable && files[id - 1].size != 0) {
+        error = commit(id, next_generation++, 0);
+        if (error != 0) {
+            return error;
+        }
+    }
+
+    handles[slot] = (handle_t){.id = id, .position = 0, .flags = flags};
+    return TM4C_FS_FD_FIRST + (int)slot;
+}
+
+int tm4c_fs_close(int fd) {
+    const int index = fd - TM4C_FS_FD_FIRST;
+
+    if (index < 0 || index >= TM4C_FS_MAX_OPEN || handles[index].id == 0) {
+        return -EBADF;
+    }
+    handles[index].id = 0;
+    return 0;
+}
+
+int tm4c_fs_read(int fd, void *data, size_t size) {
+    handle_t *const handle = handle_of(fd);
+
+    if (handle == NULL || (handle->flags & O_ACCMODE) == O_WRONLY) {
+        return -EBADF;
+    }
+
+    const file_t *const file = &files[handle->id - 1];
+    if (handle->position >= file->size) {
+        return 0;
+    }
+
+    const uint32_t count = file->size - handle->position < size ? file->size - handle->position
+                                                                  : (uint32_t)size;
+    read_range(handle->id, file->generation, handle->position, data, count);
+    handle->position += count;
+    return (int)count;
+}
+
+int tm4c_fs_write(int fd, const void *data, size_t size) {
+    handle_t *const handle = handle_of(fd);
+
+    if (handle == NULL || (handle->flags & O_ACCMODE) == O_RDONLY) {
+        return -EBADF;
+    }
+
+    file_t *const file = &files[handle->id - 1];
+    if ((handle->flags & O_APPEND) != 0) {
+        handle->position = file->size;
+    }
+    if (size == 0) {
+        return 0;
+    }
+
+    const int written = handle->position < file->size
+        ? rewrite(handle->id, handle->position, data, (uint32_t)size)
+        : write_data(handle->id, file->generation, handle->position, data, (uint32_t)size);
+    if (written < 0) {
+        return written;
+    }
+
+    handle->position += (uint32_t)written;
+    if (handle->position > file->size) {
+        file->size = handle->position;
+    }
+    return written;
+}
+
+int tm4c_fs_lseek(int fd, int offset, int whence) {
+    handle_t *const handle = handle_of(fd);
+
+    if (handle == NULL) {
+        return -EBADF;
+    }
+
+    int64_t position = offset;
+    if (whence == SEEK_CUR) {
+        position += handle->position;
+    } else if (whence == SEEK_END) {
+        position += files[handle->id - 1].size;
+    } else if (whence != SEEK_SET) {
+        return -EINVAL;
+    }
+    if (position < 0 || position > INT32_MAX) {
+        return -EINVAL;
+    }
+
+    handle->position = (uint32_t)position;
+    return (int)position;
+}
+
+int tm4c_fs_unlink(const char *name) {
+    const int error = ensure_mounted();
+    if (error != 0) {
+        return error;
+    }
+
+    const uint32_t id = find(name, strlen(name));
+    if (id == 0) {
+        return -ENOENT;
+    }
+    for (uint32_t slot = 0; slot < TM4C_FS_MAX_OPEN; slot++) {
+        if (handles[slot].id == id) {
+            return -EBUSY;
+        }
+    }
+
+    const uint32_t generation = next_generation++;
+    const int offset = append(RECORD_DELETE, id, generation, 0, NULL, 0);
+    if (offset < 0) {
+        return offset;
+    }
+
+    files[id - 1] = (file_t){.generation = generation, .create = 0, .size = 0};
+    return 0;
+}
+
+int tm4c_fs_stat(const char *name, struct stat *st) {
+    const int error = ensure_mounted();
+    if (error != 0) {
+        return error;
+    }
+
+    const uint32_t id = find(name, strlen(name));
+    if (id == 0) {
+        return -ENOENT;
+    }
+
+    fill_stat(&files[id - 1], st);
+    return 0;
+}
+
+int tm4c_fs_fstat(int fd, struct stat *st) {
+    const handle_t *const handle = handle_of(fd);
+
+    if (handle == NULL) {
+        return -EBADF;
+    }
+
+    fill_stat(&files[handle->id - 1], st);
+    return 0;
+}
+
+int tm4c_fs_stats(tm4c_fs_stats_t *stats) {
+    const int error = ensure_mounted();
+    if (error != 0) {
+        return error;
+    }
+
+    memset(stats, 0, sizeof(*stats));
+    stats->min_erase_count = UINT32_MAX;
+    for (uint32_t block = 0; block < TM4C_FS_BLOCKS; block++) {
+        const uint32_t count = blocks[block].erase_count;
+
+        stats->min_erase_count = count < stats->min_erase_count ? count : stats->min_erase_count;
+        stats->max_erase_count = count > stats->max_erase_count ? count : stats->max_erase_count;
+        if (blocks[block].sequence != 0) {
+            stats->live_bytes += live_bytes(block);
+        }
+    }
+
+    // all free blocks but the one kept for the collector
+    const uint32_t free = free_blocks();
+    stats->free_bytes = head_room() + (free > 1 ? free - 1 : 0) * MAX_PAYLOAD;
+    for (uint32_t id = 1; id <= TM4C_FS_MAX_FILES; id++) {
+        stats->files += files[id - 1].create != 0 ? 1 : 0;
+    }
+
+    return 0;
+}
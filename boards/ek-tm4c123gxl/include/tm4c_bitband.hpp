@@ -0,0 +1,195 @@
+/**
+ * @file tm4c_bitband.hpp
+ * @author Esteban Duran (@astroesteban)
+ * @brief Atomic single-bit access to SRAM and peripheral registers through
+ *        the bit-band aliases of the Cortex-M4.
+ *
+ * @details The first megabyte of SRAM (0x20000000) and of the peripherals
+ *          (0x40000000) is mirrored a second time, one word per bit, at
+ *          0x22000000 and 0x42000000. Storing 0 or 1 to the word of a bit
+ *          is a read-modify-write of the whole word that the bus does as one
+ *          transaction; loading it reads the bit as 0 or 1. An interrupt can
+ *          not split it, so bits of the same SRAM word that the main loop and
+ *          ISRs share need no critical section.
+ *
+ *          On a peripheral register the other bits are read and written back
+ *          as well. Bit-band only registers whose bits keep their value when
+ *          it is written back. A write-1-to-clear status register (ADCISC,
+ *          a timer's ICR, UARTICR) clears every pending bit that reads as 1,
+ *          and a register with read side effects (UARTDR) loses data. Bit and
+ *          FieldBit refuse write-only registers at compile time. Registers
+ *          the SVD marks read-write can still be write-1-to-clear.
+ *
+ *          tm4c::bitband::Bit<Address, N> (and FieldBit for a one-bit
+ *          tm4c::Field of a register) resolve the alias at compile time,
+ *          tm4c::bitband::BitFlag<Count> packs flags into words of SRAM:
+ *
+ * @code
+ * tm4c::bitband::BitFlag<8> events;
+ *
+ * extern "C" void GPIOPortF_ISR() { events.set(BUTTON); }   // no lost updates
+ * ...
+ * if (events.test(BUTTON)) { events.clear(BUTTON); ... }
+ *
+ * using Timer0Clock = tm4c::bitband::FieldBit<SYSCTL::RCGCTIMER, SYSCTL::RCGCTIMER::R0>;
+ * Timer0Clock::set();
+ * @endcode
+ *
+ *          Only single loads and stores are atomic. Test-and-clear is a load
+ *          and a store, two contexts that both clear a flag after testing it
+ *          can still both see it set.
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @ref TM4C123GH6PM datasheet section 2.4.5 (Bit-Banding)
+ *
+ * @copyright Apache License
+ *
+ */
+#pragma once
+
+#include <cstdint>
+
+#include "tm4c_register.hpp"
+
+#if defined(TM4C_BITBAND_SIMULATED)
+// Implemented by the host tests, which have no bit-band regions. Gets and
+// puts bit of the word like a load or store of its alias would.
+extern "C" std::uint32_t tm4c_bitband_sim_read(const volatile std::uint32_t *word, unsigned bit);
+extern "C" void tm4c_bitband_sim_write(volatile std::uint32_t *word, unsigned bit, std::uint32_t value);
+#endif
+
+namespace tm4c::bitband {
+
+inline constexpr std::uint32_t sram_start = 0x20000000;
+inline constexpr std::uint32_t sram_alias = 0x22000000;
+inline constexpr std::uint32_t peripheral_start = 0x40000000;
+inline constexpr std::uint32_t peripheral_alias = 0x42000000;
+inline constexpr std::uint32_t region_size = 0x00100000;
+
+namespace detail {
+// Not constexpr, so reaching it in a constant expression is a compile error
+inline void address_not_bit_banded() {}
+} // namespace detail
+
+/**
+ * @brief Whether the byte at address has a bit-band alias.
+ */
+constexpr bool in_region(std::uint32_t address) {
+    return (address >= sram_start && address - sram_start < region_size) ||
+           (address >= peripheral_start && address - peripheral_start < region_size);
+}
+
+/**
+ * @brief The alias word of bit (0-31) of the word at address. Bits above 7
+ *        continue into the following bytes, which is what a word's bits are
+ *        on the little-endian Cortex-M4.
+ */
+constexpr std::uint32_t alias(std::uint32_t address, unsigned bit) {
+    if consteval {
+        if (!in_region(address) || !in_region(address + bit / 8) || bit > 31) {
+            detail::address_not_bit_banded();
+        }
+    }
+    const std::uint32_t alias_base = address >= peripheral_start ? peripheral_alias : sram_alias;
+    return alias_base + ((address & (region_size - 1)) << 5) + (bit << 2);
+}
+
+/**
+ * @brief The alias word of bit of a variable in SRAM. Computed at runtime
+ *        from the variable's address, one shift and one add.
+ */
+inline volatile std::uint32_t &alias_of(const volatile std::uint32_t &word, unsigned bit) {
+    const auto address = static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(&word));
+    return *reinterpret_cast<volatile std::uint32_t *>(static_cast<std::uintptr_t>(alias(address, bit)));
+}
+
+/**
+ * @brief Bit N of the register at Address, read and written through its
+ *        alias. The bus writes the register's other bits back unchanged, so
+ *        never use it on write-1-to-clear registers (see the file comment).
+ */
+template <std::uint32_t Address, unsigned N, Access A = Access::ReadWrite>
+struct Bit {
+    static_assert(N < 32, "A register has 32 bits");
+    static_assert(in_region(Address), "Only the first megabyte of SRAM and peripherals is bit-banded");
+    static_assert(A != Access::WriteOnly,
+                  "A bit-band store reads the register, write-only ones (often write-1-to-clear) can not be used");
+
+    static constexpr std::uint32_t address = alias(Address, N);
+
+    using Alias = Register<address, A>;
+
+    [[gnu::always_inline]] static void set() noexcept { Alias::write(1); }
+
+    [[gnu::always_inline]] static void clear() noexcept { Alias::write(0); }
+
+    [[gnu::always_inline]] static void write(bool value) noexcept { Alias::write(value ? 1U : 0U); }
+
+    [[gnu::always_inline]] static bool read() noexcept { return Alias::read() != 0; }
+};
+
+/**
+ * @brief The bit of a one-bit field of a register, e.g. of the generated
+ *        headers: FieldBit<SYSCTL::RCGCGPIO, SYSCTL::RCGCGPIO::R5>. The same
+ *        restrictions as for Bit apply, no write-1-to-clear registers.
+ */
+template <typename R, auto F>
+struct FieldBit : Bit<R::address, F.offset, R::access> {
+    static_assert(F.width == 1, "Only one-bit fields can be bit-banded");
+};
+
+/**
+ * @brief Count flags packed into words of SRAM. Every flag is set, cleared
+ *        and tested alone through its alias, so the main loop and ISRs can
+ *        share the words without masking interrupts.
+ *
+ * @details The whole 32 KB SRAM of the TM4C123 lies in the bit-band region
+ *          (tm4c123gh6pm.ld asserts that), so any BitFlag that is not const
+ *          is eligible, whether global, static or on the stack. A constinit
+ *          BitFlag lives in .bss and costs no constructor.
+ */
+template <unsigned Count = 1>
+class BitFlag {
+public:
+    static_assert(Count > 0, "A BitFlag holds at least one flag");
+
+    static constexpr unsigned count = Count;
+
+    constexpr BitFlag() noexcept = default;
+
+    void set(unsigned index = 0) noexcept { store(index, 1); }
+
+    void clear(unsigned index = 0) noexcept { store(index, 0); }
+
+    void write(unsigned index, bool value) noexcept { store(index, value ? 1U : 0U); }
+
+    [[nodiscard]] bool test(unsigned index = 0) const noexcept { return load(index) != 0; }
+
+    /// Flags 32 * index to 32 * index + 31 read at once, bit n is flag n
+    [[nodiscard]] std::uint32_t word(unsigned index = 0) const noexcept { return words_[index]; }
+
+private:
+    static constexpr unsigned word_count = (Count + 31) / 32;
+
+    void store(unsigned index, std::uint32_t value) noexcept {
+#if defined(TM4C_BITBAND_SIMULATED)
+        tm4c_bitband_sim_write(&words_[index / 32], index % 32, value);
+#else
+        alias_of(words_[index / 32], index % 32) = value;
+#endif
+    }
+
+    std::uint32_t load(unsigned index) const noexcept {
+#if defined(TM4C_BITBAND_SIMULATED)
+        return tm4c_bitband_sim_read(&words_[index / 32], index % 32);
+#else
+        return alias_of(words_[index / 32], index % 32);
+#endif
+    }
+
+    volatile std::uint32_t words_[word_count]{};
+};
+
+} // namespace tm4c::bitband
@@ -0,0 +1,48 @@
+/**
+ * @file tm4c_boot.h
+ * @author Esteban Duran (@astroesteban)
+ * @brief Information Reset_Handler records about the boot sequence.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#ifndef TM4C_BOOT_H
+#define TM4C_BOOT_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Core clock cycles spent in each stage of Reset_Handler, measured
+ *        with the DWT cycle counter. The stages run back to back so they add
+ *        up to (almost) the total.
+ *
+ * @note The clock stage changes the core clock, so the cycles before and
+ *       after it are not the same length in time.
+ */
+typedef struct {
+    uint32_t fpu;           // FPU bring-up
+    uint32_t clock;         // clock tree configuration and PLL lock
+    uint32_t data;          // copying the initialized regions from flash
+    uint32_t bss;           // zeroing the uninitialized regions
+    uint32_t persistent;    // checking (and on a cold boot clearing) .persistent
+    uint32_t vectors;       // relocating the vector table (TM4C_RAM_VECTORS)
+    uint32_t constructors;  // static initializers (__libc_init_array)
+    uint32_t total;         // Reset_Handler entry to main()
+} tm4c_boot_times_t;
+
+/**
+ * @brief Filled in by Reset_Handler right before main() is called.
+ */
+extern tm4c_boot_times_t tm4c_boot_times;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TM4C_BOOT_H
@@ -0,0 +1,178 @@
+/**
+ * @file tm4c_clock.h
+ * @author Esteban Duran (@astroesteban)
+ * @brief Compile-time configuration of the TM4C123 clock tree.
+ *
+ * @details The clock tree is described by four values which are normally
+ *          set through CMake (see cmake/board_options.cmake) but can also be
+ *          defined by hand before this header is included:
+ *
+ *          TM4C_CLOCK_SOURCE_MOSC / TM4C_CLOCK_SOURCE_PIOSC
+ *              Oscillator feeding the PLL (or the system clock when the PLL
+ *              is bypassed).
+ *          TM4C_XTAL_HZ        Frequency of the crystal on the main oscillator.
+ *          TM4C_CLOCK_USE_PLL  1 to run from the 400 MHz PLL, 0 to bypass it.
+ *          TM4C_SYSCLK_HZ      The requested system (core) clock.
+ *
+ *          Every combination is validated by the preprocessor and static
+ *          assertions, so an impossible clock tree fails the build instead of
+ *          silently running at the wrong speed. TM4C_SYSCLK_HZ is then the
+ *          exact core clock and can be used for timer and baud rate math.
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#ifndef TM4C_CLOCK_H
+#define TM4C_CLOCK_H
+
+#include <assert.h>
+#include <stdint.h>
+
+// +--------------------------------------------------------------------------+
+// +                         Default Configuration                            +
+// +--------------------------------------------------------------------------+
+#if !defined(TM4C_CLOCK_SOURCE_MOSC) && !defined(TM4C_CLOCK_SOURCE_PIOSC)
+#define TM4C_CLOCK_SOURCE_MOSC
+#endif
+
+#ifndef TM4C_XTAL_HZ
+#define TM4C_XTAL_HZ 16000000UL         // the LaunchPad ships with a 16 MHz crystal
+#endif
+
+#ifndef TM4C_CLOCK_USE_PLL
+#define TM4C_CLOCK_USE_PLL 1
+#endif
+
+#ifndef TM4C_SYSCLK_HZ
+#define TM4C_SYSCLK_HZ 80000000UL
+#endif
+
+// +--------------------------------------------------------------------------+
+// +                            Derived Values                                +
+// +--------------------------------------------------------------------------+
+
+/* Frequency of the precision internal oscillator */
+#define TM4C_PIOSC_HZ 16000000UL
+
+/* Frequency of the PLL VCO. We always use the DIV400 path of RCC2. */
+#define TM4C_PLL_HZ 400000000UL
+
+/* The fastest the TM4C123GH6PM is allowed to run */
+#define TM4C_SYSCLK_MAX_HZ 80000000UL
+
+#if defined(TM4C_CLOCK_SOURCE_MOSC) && defined(TM4C_CLOCK_SOURCE_PIOSC)
+#error "Only one of TM4C_CLOCK_SOURCE_MOSC and TM4C_CLOCK_SOURCE_PIOSC can be defined"
+#endif
+
+#if defined(TM4C_CLOCK_SOURCE_MOSC)
+#define TM4C_OSC_HZ TM4C_XTAL_HZ
+#else
+#define TM4C_OSC_HZ TM4C_PIOSC_HZ
+#endif
+
+/*
+ * RCC.XTAL encoding of the crystal frequency (datasheet table 5-5). The PLL
+ * needs to know the reference frequency even when the PIOSC feeds it, in
+ * which case XTAL has to be programmed to 16 MHz.
+*/
+#if defined(TM4C_CLOCK_SOURCE_PIOSC)
+#define TM4C_RCC_XTAL 0x15
+#elif TM4C_XTAL_HZ == 4000000UL
+#define TM4C_RCC_XTAL 0x06
+#elif TM4C_XTAL_HZ == 4096000UL
+#define TM4C_RCC_XTAL 0x07
+#elif TM4C_XTAL_HZ == 4915200UL
+#define TM4C_RCC_XTAL 0x08
+#elif TM4C_XTAL_HZ == 5000000UL
+#define TM4C_RCC_XTAL 0x09
+#elif TM4C_XTAL_HZ == 5120000UL
+#define TM4C_RCC_XTAL 0x0A
+#elif TM4C_XTAL_HZ == 6000000UL
+#define TM4C_RCC_XTAL 0x0B
+#elif TM4C_XTAL_HZ == 6144000UL
+#define TM4C_RCC_XTAL 0x0C
+#elif TM4C_XTAL_HZ == 7372800UL
+#define TM4C_RCC_XTAL 0x0D
+#elif TM4C_XTAL_HZ == 8000000UL
+#define TM4C_RCC_XTAL 0x0E
+#elif TM4C_XTAL_HZ == 8192000UL
+#define TM4C_RCC_XTAL 0x0F
+#elif TM4C_XTAL_HZ == 10000000UL
+#define TM4C_RCC_XTAL 0x10
+#elif TM4C_XTAL_HZ == 12000000UL
+#define TM4C_RCC_XTAL 0x11
+#elif TM4C_XTAL_HZ == 12288000UL
+#define TM4C_RCC_XTAL 0x12
+#elif TM4C_XTAL_HZ == 13560000UL
+#define TM4C_RCC_XTAL 0x13
+#elif TM4C_XTAL_HZ == 14318180UL
+#define TM4C_RCC_XTAL 0x14
+#elif TM4C_XTAL_HZ == 16000000UL
+#define TM4C_RCC_XTAL 0x15
+#elif TM4C_XTAL_HZ == 16384000UL
+#define TM4C_RCC_XTAL 0x16
+#elif TM4C_XTAL_HZ == 18000000UL
+#define TM4C_RCC_XTAL 0x17
+#elif TM4C_XTAL_HZ == 20000000UL
+#define TM4C_RCC_XTAL 0x18
+#elif TM4C_XTAL_HZ == 24000000UL
+#define TM4C_RCC_XTAL 0x19
+#elif TM4C_XTAL_HZ == 25000000UL
+#define TM4C_RCC_XTAL 0x1A
+#else
+#error "TM4C_XTAL_HZ is not one of the crystal frequencies supported by RCC.XTAL"
+#endif
+
+/* The clock the divisor is applied to */
+#if TM4C_CLOCK_USE_PLL
+#define TM4C_SYSDIV_INPUT_HZ TM4C_PLL_HZ
+#else
+#define TM4C_SYSDIV_INPUT_HZ TM4C_OSC_HZ
+#endif
+
+/*
+ * Divisor applied to the PLL/oscillator. With DIV400 the 7-bit
+ * SYSDIV2:SYSDIV2LSB field divides the 400 MHz VCO directly, when the PLL
+ * is bypassed the 6-bit SYSDIV2 field divides the oscillator.
+*/
+#define TM4C_SYSDIV (TM4C_SYSDIV_INPUT_HZ / TM4C_SYSCLK_HZ)
+
+// +--------------------------------------------------------------------------+
+// +                            Validation                                    +
+// +--------------------------------------------------------------------------+
+static_assert(TM4C_SYSCLK_HZ > 0, "TM4C_SYSCLK_HZ must not be zero");
+static_assert(TM4C_SYSCLK_HZ <= TM4C_SYSCLK_MAX_HZ,
+              "The TM4C123 cannot run faster than 80 MHz");
+static_assert(TM4C_SYSDIV_INPUT_HZ % TM4C_SYSCLK_HZ == 0,
+              "TM4C_SYSCLK_HZ is not an integer division of the clock source");
+#if TM4C_CLOCK_USE_PLL
+static_assert(TM4C_OSC_HZ >= 5000000UL && TM4C_OSC_HZ <= 25000000UL,
+              "The PLL reference has to be between 5 MHz and 25 MHz");
+static_assert(TM4C_SYSDIV >= 5 && TM4C_SYSDIV <= 128,
+              "SYSDIV2:SYSDIV2LSB can only divide the PLL by 5 to 128");
+#else
+static_assert(TM4C_SYSDIV >= 1 && TM4C_SYSDIV <= 64,
+              "SYSDIV2 can only divide the oscillator by 1 to 64");
+#endif
+
+// +--------------------------------------------------------------------------+
+// +                          Function Prototypes                             +
+// +--------------------------------------------------------------------------+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Switches the system clock to the configured clock tree. Called by
+ *        Reset_Handler before main().
+ */
+void tm4c_clock_init(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TM4C_CLOCK_H
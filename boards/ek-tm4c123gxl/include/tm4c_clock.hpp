@@ -0,0 +1,61 @@
+/**
+ * @file tm4c_clock.hpp
+ * @author Esteban Duran (@astroesteban)
+ * @brief C++ view of the clock configuration in tm4c_clock.h. Everything in
+ *        here is evaluated at compile time.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#pragma once
+
+#include <cstdint>
+
+#include "tm4c_clock.h"
+
+namespace tm4c::clock {
+
+/// The core clock Reset_Handler switches to before main()
+inline constexpr std::uint32_t core_hz = TM4C_SYSCLK_HZ;
+
+/**
+ * @brief Number of core clock cycles in the given number of microseconds.
+ */
+consteval std::uint32_t cycles_from_us(std::uint64_t microseconds) {
+    return static_cast<std::uint32_t>(microseconds * core_hz / 1'000'000U);
+}
+
+/**
+ * @brief The integer and fractional baud rate divisors of a UART running off
+ *        the system clock with 16x oversampling (UARTIBRD / UARTFBRD).
+ */
+struct UartDivisor {
+    std::uint32_t integer;
+    std::uint32_t fraction;
+};
+
+/**
+ * @brief Computes the UART divisors for the requested baud rate. Rejects baud
+ *        rates the divisor registers cannot represent at compile time.
+ *
+ * @tparam Baud The requested baud rate.
+ */
+template <std::uint32_t Baud>
+consteval UartDivisor uart_divisor() {
+    static_assert(Baud > 0, "The baud rate must not be zero");
+
+    // BRD = clk / (16 * baud). FBRD holds the fraction in 1/64ths, so scale
+    // everything by 64 (64 / 16 = 4) and round to the nearest 64th
+    constexpr std::uint64_t scaled =
+        (static_cast<std::uint64_t>(core_hz) * 4U + Baud / 2U) / Baud;
+
+    static_assert((scaled >> 6) >= 1 && (scaled >> 6) <= 0xFFFF,
+                  "The baud rate is out of range for the system clock");
+
+    return {static_cast<std::uint32_t>(scaled >> 6),
+            static_cast<std::uint32_t>(scaled & 0x3F)};
+}
+
+} // namespace tm4c::clock
@@ -0,0 +1,37 @@
+/**
+ * @file tm4c_crc.h
+ * @author Esteban Duran (@astroesteban)
+ * @brief CRC-32 (IEEE 802.3, the one zlib uses) for integrity checks of
+ *        records kept in RAM, flash or EEPROM.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#ifndef TM4C_CRC_H
+#define TM4C_CRC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Computes the CRC-32 of the buffer.
+ *
+ * @param crc The CRC of the preceding data, 0 for the first block. This
+ *            allows computing the CRC of non-contiguous data in pieces.
+ * @param data The data to add to the CRC.
+ * @param size Number of bytes of data.
+ * @return uint32_t The updated CRC.
+ */
+uint32_t tm4c_crc32(uint32_t crc, const void *data, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TM4C_CRC_H
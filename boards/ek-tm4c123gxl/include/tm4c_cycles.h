@@ -0,0 +1,50 @@
+/**
+ * @file tm4c_cycles.h
+ * @author Esteban Duran (@astroesteban)
+ * @brief Access to the DWT cycle counter of the Cortex-M4. Used to time the
+ *        boot sequence and by the benchmarks.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#ifndef TM4C_CYCLES_H
+#define TM4C_CYCLES_H
+
+#include <stdint.h>
+
+#define TM4C_DEMCR        (*((volatile uint32_t *)0xE000EDFC)) // Debug Exception and Monitor Control
+#define TM4C_DWT_CTRL     (*((volatile uint32_t *)0xE0001000)) // DWT Control
+#define TM4C_DWT_CYCCNT   (*((volatile uint32_t *)0xE0001004)) // DWT Cycle Count
+
+#define TM4C_DEMCR_TRCENA        (1UL << 24)   // enable the DWT and ITM units
+#define TM4C_DWT_CTRL_CYCCNTENA  (1UL << 0)    // enable the cycle counter
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Enables the cycle counter and restarts it from zero.
+ */
+static inline void tm4c_cycles_start(void) {
+    TM4C_DEMCR = TM4C_DEMCR | TM4C_DEMCR_TRCENA;
+    TM4C_DWT_CYCCNT = 0;
+    TM4C_DWT_CTRL = TM4C_DWT_CTRL | TM4C_DWT_CTRL_CYCCNTENA;
+}
+
+/**
+ * @brief Reads the current value of the cycle counter. It wraps around every
+ *        2^32 cycles (~53 s at 80 MHz), unsigned subtraction of two reads is
+ *        therefore always correct for shorter intervals.
+ */
+static inline uint32_t tm4c_cycles(void) {
+    return TM4C_DWT_CYCCNT;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TM4C_CYCLES_H
@@ -0,0 +1,108 @@
+/**
+ * @file tm4c_eeprom.h
+ * @author Esteban Duran (@astroesteban)
+ * @brief A key-value store in the 2 KB on-chip EEPROM with a write-back RAM
+ *        cache, for configuration that is read often and written rarely.
+ *
+ * @details tm4c_eeprom_init() reads the first TM4C_EEPROM_CACHE bytes of the
+ *          EEPROM into RAM once. After that tm4c_eeprom_get() only copies out
+ *          of the cache and tm4c_eeprom_set() only changes the cache and marks
+ *          the words that actually changed. Nothing reaches the EEPROM until
+ *          tm4c_eeprom_flush(), which writes every run of changed words with
+ *          one EEBLOCK/EEOFFSET setup and the auto-incrementing EERDWRINC
+ *          register. Setting a value several times between flushes costs one
+ *          write of its words, setting it to what it already is costs none.
+ *
+ *          Records are a header word (key and size), the value padded to
+ *          whole words and, with TM4C_EEPROM_CRC, the CRC-32 of both. A value
+ *          a reset tore apart fails its CRC, tm4c_eeprom_get() then reports
+ *          -EBADMSG until the value is set again. New records are linked
+ *          into the store by the last word a flush writes, so a torn flush
+ *          never adds half a record.
+ *
+ *          A key keeps the size it was first set with. The store is not
+ *          reentrant, use it from one context.
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @ref TM4C123GH6PM datasheet section 8.2.4 (EEPROM)
+ *
+ * @copyright Apache License
+ *
+ */
+#ifndef TM4C_EEPROM_H
+#define TM4C_EEPROM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Bytes of EEPROM the store uses and caches in RAM, a multiple of 64 (cmake option) */
+#ifndef TM4C_EEPROM_CACHE
+#define TM4C_EEPROM_CACHE 512
+#endif
+
+#define TM4C_EEPROM_SIZE 2048           // bytes of EEPROM on the TM4C123GH6PM
+#define TM4C_EEPROM_KEY_MAX 0xFFFE      // 0xFFFF marks the end of the records
+
+/**
+ * @brief Usage of the store and what the cache saved.
+ */
+typedef struct {
+    uint32_t records;
+    uint32_t used_bytes;            // records and the store header
+    uint32_t dirty_words;           // changed since the last flush
+    uint32_t flushes;               // flushes that wrote anything
+    uint32_t written_words;         // words written to the EEPROM in total
+} tm4c_eeprom_stats_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Powers up the EEPROM, completes an operation a reset interrupted
+ *        and loads the cache. Starts an empty store if the EEPROM holds
+ *        none. Every other function calls it first.
+ *
+ * @return int 0 or -EIO if the EEPROM reports an error.
+ */
+int tm4c_eeprom_init(void);
+
+/**
+ * @brief Copies the value of a key out of the cache.
+ *
+ * @return int 0, -ENOENT, -EINVAL if the key has another size or -EBADMSG if
+ *         the value was torn by a reset.
+ */
+int tm4c_eeprom_get(uint16_t key, void *value, size_t size);
+
+/**
+ * @brief Sets the value of a key in the cache, tm4c_eeprom_flush() writes it.
+ *
+ * @return int 0, -EINVAL if the key has another size or -ENOSPC if a new
+ *         key does not fit into TM4C_EEPROM_CACHE.
+ */
+int tm4c_eeprom_set(uint16_t key, const void *value, size_t size);
+
+/**
+ * @brief Writes the words changed since the last flush to the EEPROM. Takes
+ *        about 110 us per word while the EEPROM works (flash operations
+ *        stall meanwhile).
+ *
+ * @return int The number of words written or -EIO.
+ */
+int tm4c_eeprom_flush(void);
+
+/**
+ * @brief Removes all keys, written with the next flush.
+ */
+int tm4c_eeprom_clear(void);
+
+tm4c_eeprom_stats_t tm4c_eeprom_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TM4C_EEPROM_H
@@ -0,0 +1,69 @@
+/**
+ * @file tm4c_eeprom.hpp
+ * @author Esteban Duran (@astroesteban)
+ * @brief Typed keys for the EEPROM key-value store in tm4c_eeprom.h.
+ *
+ * @details A tm4c::Setting ties a key to a type once, so every read and write
+ *          of it agrees on the size:
+ *
+ * @code
+ * constexpr tm4c::Setting<std::uint32_t, 1> baud_rate;
+ * constexpr tm4c::Setting<Calibration, 2> calibration;
+ *
+ * uart_init(baud_rate.get(115200));    // from the RAM cache
+ * baud_rate.set(9600);                 // written by the next tm4c_eeprom_flush()
+ * @endcode
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+#include "tm4c_eeprom.h"
+
+namespace tm4c {
+
+/**
+ * @brief A value of type T stored under Key.
+ */
+template <typename T, std::uint16_t Key>
+struct Setting {
+    static_assert(std::is_trivially_copyable_v<T>, "EEPROM values are stored as bytes");
+    static_assert(sizeof(T) <= TM4C_EEPROM_CACHE - 12, "The value does not fit into TM4C_EEPROM_CACHE");
+    static_assert(Key <= TM4C_EEPROM_KEY_MAX, "The key is reserved");
+
+    using value_type = T;
+    static constexpr std::uint16_t key = Key;
+
+    /**
+     * @brief The stored value, or fallback if there is none or it was torn.
+     */
+    static T get(const T &fallback = T{}) noexcept {
+        T value;
+        return tm4c_eeprom_get(Key, &value, sizeof(T)) == 0 ? value : fallback;
+    }
+
+    /**
+     * @return bool false if there is no room for a new key (or the key was
+     *         stored with another type).
+     */
+    static bool set(const T &value) noexcept {
+        return tm4c_eeprom_set(Key, &value, sizeof(T)) == 0;
+    }
+
+    /**
+     * @brief Whether a valid value is stored.
+     */
+    static bool exists() noexcept {
+        T value;
+        return tm4c_eeprom_get(Key, &value, sizeof(T)) == 0;
+    }
+};
+
+} // namespace tm4c
@@ -0,0 +1,90 @@
+/**
+ * @file tm4c_fault.h
+ * @author Esteban Duran (@astroesteban)
+ * @brief Post-mortem crash records.
+ *
+ * @details Every fault (NMI, HardFault, MemManage, BusFault, UsageFault) and
+ *          every interrupt without a handler ends up in the same naked entry.
+ *          It saves the stacked exception frame, the fault status registers
+ *          and the top of the stack into a record in the persistent SRAM
+ *          region (tm4c_persistent.h) and immediately resets the chip. After
+ *          the reboot the firmware can report or store the record, or you can
+ *          dump it with the debugger and decode it on the host:
+ *
+ * @code
+ * (gdb) dump binary value crash.bin tm4c_crash_record
+ * $ utils/decode_crash.py firmware.elf crash.bin
+ * @endcode
+ *
+ *          When a debugger is attached the core halts on a breakpoint first,
+ *          so faults can still be inspected live.
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#ifndef TM4C_FAULT_H
+#define TM4C_FAULT_H
+
+#include <stdint.h>
+
+#define TM4C_CRASH_MAGIC        0x43524153UL    // "CRAS"
+#define TM4C_CRASH_VERSION      1UL
+#define TM4C_CRASH_STACK_WORDS  16
+
+/**
+ * @brief A crash record. The layout is decoded by utils/decode_crash.py, bump
+ *        TM4C_CRASH_VERSION when changing it.
+ */
+typedef struct {
+    uint32_t magic;             // TM4C_CRASH_MAGIC if the record is valid
+    uint32_t version;           // TM4C_CRASH_VERSION
+    uint32_t count;             // crashes since the last cold boot
+    uint32_t vector;            // exception number (IPSR) that was taken
+    uint32_t r0;                // the exception frame pushed by the core
+    uint32_t r1;
+    uint32_t r2;
+    uint32_t r3;
+    uint32_t r12;
+    uint32_t lr;
+    uint32_t pc;
+    uint32_t xpsr;
+    uint32_t exc_return;        // LR on exception entry
+    uint32_t sp;                // stack pointer before the exception
+    uint32_t cfsr;              // Configurable Fault Status
+    uint32_t hfsr;              // HardFault Status
+    uint32_t mmfar;             // MemManage Fault Address
+    uint32_t bfar;              // BusFault Address
+    uint32_t stack[TM4C_CRASH_STACK_WORDS]; // words at sp and above
+    uint32_t crc;               // CRC-32 of everything above
+} tm4c_crash_record_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief The record of the last crash.
+ *
+ * @return const tm4c_crash_record_t* The record, or NULL if there was no
+ *         crash since it was last cleared or since the last cold boot.
+ */
+const tm4c_crash_record_t *tm4c_crash_record_get(void);
+
+/**
+ * @brief Marks the record as handled. The crash counter is kept.
+ */
+void tm4c_crash_record_clear(void);
+
+/**
+ * @brief Number of crashes since the last cold boot.
+ */
+uint32_t tm4c_crash_count(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TM4C_FAULT_H
@@ -0,0 +1,945 @@
+/**
+ * @file tm4c_format.hpp
+ * @author Esteban Duran (@astroesteban)
+ * @brief std::format style formatting whose format strings are parsed at
+ *        compile time.
+ *
+ * @details newlib-nano's printf parses the format string on every call,
+ *          takes its arguments through a va_list and promotes every float to
+ *          a double the Cortex-M4F can only handle in software. Here the
+ *          format string is parsed by a consteval constructor instead: it is
+ *          checked against the argument types (a mismatch does not compile)
+ *          and split into the literal text and one parsed replacement field
+ *          per argument. At runtime only the arguments are converted, with
+ *          integer arithmetic and into a buffer on the stack, no heap.
+ *
+ * @code
+ * tm4c::println("adc {}: {:5} mV, status {:#06x}", channel, millivolts, status);
+ * tm4c::format_to(sink, "{:.2f} C", temperature);
+ * char text[32];
+ * tm4c::snformat(text, sizeof(text), "{:>8}", name);
+ * @endcode
+ *
+ *          A replacement field is `{}` or `{:[[fill]align][sign][#][0][width][.precision][type]}`
+ *          with the arguments taken in order (no argument indices, no nested
+ *          fields). `{{` and `}}` are literal braces.
+ *
+ *          | Argument | Types |
+ *          | -------- | ----- |
+ *          | integers | `d` (default), `x`, `X`, `b`, `B`, `o`, `c` |
+ *          | `char` | `c` (default) or an integer type |
+ *          | `bool` | `s` (default, true/false) or an integer type |
+ *          | `float`, `double` | `f`, precision 0 to 9 (default 6) |
+ *          | strings | `s`, the precision truncates |
+ *          | pointers | `p` (default), 0x and the address in hex |
+ *
+ *          A floating point argument with neither a type nor a precision
+ *          drops the trailing zeros of its 6 decimals. Values whose integer
+ *          part fits 64 bits are printed in fixed notation, larger ones as
+ *          d.ddddde+XX. Floats are converted exactly, doubles are exact to
+ *          2^-60.
+ *
+ *          Output is collected in TM4C_FORMAT_BUFFER bytes on the stack and
+ *          handed to the sink in chunks. print() writes to stdout, i.e. to
+ *          UART0 or the ITM text port depending on TM4C_STDIO_BACKEND, past
+ *          stdio's FILE buffering.
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @ref https://en.cppreference.com/w/cpp/utility/format/spec
+ *
+ * @copyright Apache License
+ *
+ */
+#pragma once
+
+#include <unistd.h>
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+/* Bytes formatted on the stack before they are handed to the sink */
+#ifndef TM4C_FORMAT_BUFFER
+#define TM4C_FORMAT_BUFFER 64
+#endif
+
+namespace tm4c {
+
+namespace format_detail {
+
+/// What an argument is formatted as, every supported type maps to one
+enum class Kind : std::uint8_t {
+    Bool, Char, Int32, UInt32, Int64, UInt64, Float, Double, String, Pointer,
+};
+
+template <typename T>
+consteval Kind kind_of() {
+    using U = std::remove_cvref_t<T>;
+
+    if constexpr (std::same_as<U, bool>) {
+        return Kind::Bool;
+    } else if constexpr (std::same_as<U, char>) {
+        return Kind::Char;
+    } else if constexpr (std::signed_integral<U>) {
+        return sizeof(U) <= 4 ? Kind::Int32 : Kind::Int64;
+    } else if constexpr (std::unsigned_integral<U>) {
+        return sizeof(U) <= 4 ? Kind::UInt32 : Kind::UInt64;
+    } else if constexpr (std::same_as<U, float>) {
+        return Kind::Float;
+    } else if constexpr (std::floating_point<U>) {
+        return Kind::Double;
+    } else if constexpr (std::convertible_to<U, std::string_view>) {
+        return Kind::String;
+    } else if constexpr (std::is_pointer_v<U> || std::is_null_pointer_v<U>) {
+        return Kind::Pointer;
+    } else {
+        static_assert(sizeof(U) == 0, "tm4c::format cannot format this type, convert it first");
+    }
+}
+
+/**
+ * @brief A parsed replacement field.
+ */
+struct Spec {
+    char fill = ' ';
+    char align = 0;                 // '<', '>', '^' or 0 for the default of the type
+    char sign = '-';                // '-', '+' or ' '
+    bool alternate = false;         // '#': 0x, 0b or 0 prefix
+    bool zero = false;              // '0': pad with zeros after the sign and prefix
+    std::uint8_t width = 0;
+    std::int8_t precision = -1;
+    char type = 0;
+};
+
+/**
+ * @brief The literal text in front of a replacement field (or after the last
+ *        one). Escaped pieces contain `{{` or `}}`.
+ */
+struct Piece {
+    std::uint16_t offset = 0;
+    std::uint16_t length = 0;
+    bool escaped = false;
+};
+
+/**
+ * @brief Not constexpr on purpose: a format string that reaches it while it
+ *        is parsed at compile time does not compile, and the error names it.
+ */
+inline void invalid_format_string(const char *reason) {
+    (void)reason;
+}
+
+consteval bool is_integer_type(char type) {
+    return type == 'd' || type == 'x' || type == 'X' || type == 'b' || type == 'B' || type == 'o';
+}
+
+consteval std::size_t parse_number(std::string_view text, std::size_t position, int &value,
+                                   int limit) {
+    value = 0;
+    while (position < text.size() && text[position] >= '0' && text[position] <= '9') {
+        value = value * 10 + (text[position] - '0');
+        if (value > limit) {
+            invalid_format_string("width or precision is too large");
+        }
+        position++;
+    }
+    return position;
+}
+
+consteval void check_spec(const Spec &spec, Kind kind) {
+    const bool numeric_flags = spec.sign != '-' || spec.alternate || spec.zero;
+
+    switch (kind) {
+    case Kind::Int32:
+    case Kind::UInt32:
+    case Kind::Int64:
+    case Kind::UInt64:
+        if (spec.type != 0 && spec.type != 'c' && !is_integer_type(spec.type)) {
+            invalid_format_string("invalid type for an integer");
+        }
+        if (spec.precision >= 0) {
+            invalid_format_string("an integer has no precision");
+        }
+        break;
+    case Kind::Bool:
+    case Kind::Char:
+        if (spec.type == 0 || spec.type == (kind == Kind::Bool ? 's' : 'c')) {
+            if (numeric_flags) {
+                invalid_format_string("sign, '#' and '0' need an integer type");
+            }
+        } else if (!is_integer_type(spec.type)) {
+            invalid_format_string("invalid type for a bool or char");
+        }
+        if (spec.precision >= 0) {
+            invalid_format_string("a bool or char has no precision");
+        }
+        break;
+    case Kind::Float:
+    case Kind::Double:
+        if (spec.type != 0 && spec.type != 'f') {
+            invalid_format_string("invalid type for a floating point number");
+        }
+        if (spec.alternate) {
+            invalid_format_string("'#' is not supported for floating point numbers");
+        }
+        if (spec.precision > 9) {
+            invalid_format_string("the precision of a floating point number is at most 9");
+        }
+        break;
+    case Kind::String:
+        if (spec.type != 0 && spec.type != 's') {
+            invalid_format_string("invalid type for a string");
+        }
+        if (numeric_flags) {
+            invalid_format_string("sign, '#' and '0' are not supported for strings");
+        }
+        break;
+    case Kind::Pointer:
+        if (spec.type != 0 && spec.type != 'p') {
+            invalid_format_string("invalid type for a pointer");
+        }
+        if (spec.sign != '-' || spec.alternate || spec.precision >= 0) {
+            invalid_format_string("a pointer only takes fill, align, '0' and width");
+        }
+        break;
+    }
+}
+
+/**
+ * @brief Parses the replacement field that starts after the `{` at position.
+ *
+ * @return std::size_t The position of the closing `}`.
+ */
+consteval std::size_t parse_spec(std::string_view text, std::size_t position, Spec &spec,
+                                 Kind kind) {
+    auto is_align = [](char c) { return c == '<' || c == '>' || c == '^'; };
+    auto at = [&](std::size_t i) { return i < text.size() ? text[i] : '\0'; };
+
+    if (at(position) == '}') {
+        check_spec(spec, kind);
+        return position;
+    }
+    if (at(position) != ':') {
+        invalid_format_string("argument indices are not supported, use {} or {:spec}");
+    }
+    position++;
+
+    if (is_align(at(position + 1)) && at(position) != '{' && at(position) != '}') {
+        spec.fill = at(position);
+        spec.align = at(position + 1);
+        position += 2;
+    } else if (is_align(at(position))) {
+        spec.align = at(position);
+        position++;
+    }
+
+    if (at(position) == '+' || at(position) == '-' || at(position) == ' ') {
+        spec.sign = at(position++);
+    }
+    if (at(position) == '#') {
+        spec.alternate = true;
+        position++;
+    }
+    if (at(position) == '0') {
+        spec.zero = true;
+        position++;
+    }
+
+    int number = 0;
+    position = parse_number(text, position, number, 255);
+    spec.width = static_cast<std::uint8_t>(number);
+
+    if (at(position) == '.') {
+        const std::size_t digits = position + 1;
+
+        position = parse_number(text, digits, number, 127);
+        if (position == digits) {
+            invalid_format_string("'.' without a precision");
+        }
+        spec.precision = static_cast<std::int8_t>(number);
+    }
+
+    if (at(position) == '{') {
+        invalid_format_string("nested replacement fields are not supported");
+    }
+    if (at(position) != '}' && at(position) != '\0') {
+        spec.type = at(position++);
+    }
+    if (at(position) != '}') {
+        invalid_format_string("missing '}' or invalid replacement field");
+    }
+
+    check_spec(spec, kind);
+    return position;
+}
+
+} // namespace format_detail
+
+/**
+ * @brief A format string checked against the argument types and split into
+ *        pieces of literal text and replacement fields at compile time.
+ *        Functions take it as FormatString<std::type_identity_t<Args>...>
+ *        so the arguments alone decide the types, like std::format_string.
+ */
+template <typename... Args>
+struct FormatString {
+    static constexpr std::size_t count = sizeof...(Args);
+
+    const char *text;
+    std::array<format_detail::Piece, count + 1> pieces{};
+    std::array<format_detail::Spec, count> specs{};
+
+    template <std::size_t N>
+    consteval FormatString(const char (&literal)[N]) : text{literal} {
+        using namespace format_detail;
+
+        const std::string_view view{literal, N - 1};
+        const std::array<Kind, count> kinds{kind_of<Args>()...};
+        std::size_t argument = 0;
+        std::size_t start = 0;
+        bool escaped = false;
+
+        if (view.size() > UINT16_MAX) {
+            invalid_format_string("format string is too long");
+        }
+
+        for (std::size_t i = 0; i < view.size(); i++) {
+            const bool doubled = i + 1 < view.size() && view[i + 1] == view[i];
+
+            if (view[i] == '}') {
+                if (!doubled) {
+                    invalid_format_string("unmatched '}', write '}}' for a brace");
+                }
+                escaped = true;
+                i++;
+            } else if (view[i] == '{') {
+                if (doubled) {
+                    escaped = true;
+                    i++;
+                    continue;
+                }
+                if (argument == count) {
+                    invalid_format_string("more replacement fields than arguments");
+                }
+
+                pieces[argument] = {static_cast<std::uint16_t>(start),
+                                    static_cast<std::uint16_t>(i - start), escaped};
+                i = parse_spec(view, i + 1, specs[argument], kinds[argument]);
+                argument++;
+                start = i + 1;
+                escaped = false;
+            }
+        }
+
+        if (argument != count) {
+            invalid_format_string("fewer replacement fields than arguments");
+        }
+        pieces[count] = {static_cast<std::uint16_t>(start),
+                         static_cast<std::uint16_t>(view.size() - start), escaped};
+    }
+};
+
+/**
+ * @brief Where formatted text goes: a buffer that is handed to a flush
+ *        function whenever it is full. Without a flush function the text
+ *        that does not fit is counted but dropped.
+ */
+class Output {
+public:
+    using Flush = void (*)(Output &output);
+
+    constexpr Output(char *buffer, std::size_t capacity, Flush flush = nullptr,
+                     void *context = nullptr)
+        : buffer_{buffer}, capacity_{capacity}, flush_{flush}, context_{context} {}
+
+    void put(char c) {
+        if (room() != 0) {
+            buffer_[used_++] = c;
+        }
+        total_++;
+    }
+
+    void write(const char *data, std::size_t size) {
+        total_ += size;
+        while (size > 0) {
+            const std::size_t chunk = size < room() ? size : room();
+
+            if (chunk == 0) {
+                return;
+            }
+            std::memcpy(buffer_ + used_, data, chunk);
+            used_ += chunk;
+            data += chunk;
+            size -= chunk;
+        }
+    }
+
+    void fill(char c, std::size_t count) {
+        total_ += count;
+        while (count > 0) {
+            const std::size_t chunk = count < room() ? count : room();
+
+            if (chunk == 0) {
+                return;
+            }
+            std::memset(buffer_ + used_, c, chunk);
+            used_ += chunk;
+            count -= chunk;
+        }
+    }
+
+    /// Hands the buffered text to the flush function
+    void flush() {
+        if (flush_ != nullptr && used_ != 0) {
+            flush_(*this);
+            used_ = 0;
+        }
+    }
+
+    [[nodiscard]] const char *data() const { return buffer_; }
+    [[nodiscard]] std::size_t used() const { return used_; }
+    [[nodiscard]] void *context() const { return context_; }
+
+    /// Characters formatted so far, including the ones that were dropped
+    [[nodiscard]] std::size_t size() const { return total_; }
+
+private:
+    /// Room left in the buffer, flushing it first if it is full
+    std::size_t room() {
+        if (used_ == capacity_) {
+            flush();
+        }
+        return capacity_ - used_;
+    }
+
+    char *buffer_;
+    std::size_t capacity_;
+    std::size_t used_ = 0;
+    std::size_t total_ = 0;
+    Flush flush_;
+    void *context_;
+};
+
+
+namespace format_detail {
+
+/// An argument formatted as an address
+struct Pointer {
+    std::uintptr_t address;
+};
+
+/**
+ * @brief Writes the decimal digits of value backwards, ending in front of
+ *        end.
+ *
+ * @return char* The first digit.
+ */
+inline char *write_decimal(char *end, std::uint32_t value) {
+    do {
+        *--end = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+
+    return end;
+}
+
+/**
+ * @brief 64-bit version. The digits are split off 9 at a time, so only one
+ *        in 9 divisions is done on 64 bits (in software).
+ */
+inline char *write_decimal(char *end, std::uint64_t value) {
+    while (value >> 32 != 0) {
+        const auto chunk = static_cast<std::uint32_t>(value % 1000000000U);
+        char *const chunk_end = end;
+
+        value /= 1000000000U;
+        end = write_decimal(end, chunk);
+        while (chunk_end - end < 9) {
+            *--end = '0';
+        }
+    }
+
+    return write_decimal(end, static_cast<std::uint32_t>(value));
+}
+
+/**
+ * @brief Writes the digits of value in the base of the integer type
+ *        backwards, ending in front of end.
+ *
+ * @return char* The first digit.
+ */
+template <typename Unsigned>
+char *write_digits(char *end, Unsigned value, char type) {
+    const unsigned shift = type == 'x' || type == 'X' ? 4
+                         : type == 'o'                ? 3
+                         : type == 'b' || type == 'B' ? 1
+                                                      : 0;
+
+    if (shift == 0) {
+        return write_decimal(end, value);
+    }
+
+    const char *const digits = type == 'X' ? "0123456789ABCDEF" : "0123456789abcdef";
+    do {
+        *--end = digits[static_cast<unsigned>(value) & ((1U << shift) - 1)];
+        value >>= shift;
+    } while (value != 0);
+
+    return end;
+}
+
+inline void write_padded(Output &out, const Spec &spec, const char *text, std::size_t size,
+                         char default_align) {
+    const std::size_t padding = spec.width > size ? spec.width - size : 0;
+    const char align = spec.align != 0 ? spec.align : default_align;
+    const std::size_t before = align == '>' ? padding : align == '^' ? padding / 2 : 0;
+
+    out.fill(spec.fill, before);
+    out.write(text, size);
+    out.fill(spec.fill, padding - before);
+}
+
+/**
+ * @brief Writes a number whose text starts with prefix characters of sign
+ *        and base prefix. '0' pads between those and the digits.
+ */
+inline void write_number(Output &out, const Spec &spec, const char *text, std::size_t size,
+                         std::size_t prefix) {
+    if (spec.zero && spec.align == 0) {
+        out.write(text, prefix);
+        out.fill('0', spec.width > size ? spec.width - size : 0);
+        out.write(text + prefix, size - prefix);
+    } else {
+        write_padded(out, spec, text, size, '>');
+    }
+}
+
+/**
+ * @brief Puts the sign in front of text if there is one to show.
+ */
+inline char *write_sign(char *text, const Spec &spec, bool negative) {
+    if (negative) {
+        *--text = '-';
+    } else if (spec.sign != '-') {
+        *--text = spec.sign;
+    }
+    return text;
+}
+
+template <typename Unsigned>
+void format_integer(Output &out, const Spec &spec, Unsigned magnitude, bool negative) {
+    if (spec.type == 'c') {
+        const auto c = static_cast<char>(magnitude);
+
+        write_padded(out, spec, &c, 1, '<');
+        return;
+    }
+
+    char buffer[sizeof(Unsigned) * 8 + 3];  // binary digits, sign and base prefix
+    char *const end = buffer + sizeof(buffer);
+    char *const digits = write_digits(end, magnitude, spec.type);
+    char *text = digits;
+
+    if (spec.alternate && spec.type == 'o') {
+        if (magnitude != 0) {
+            *--text = '0';
+        }
+    } else if (spec.alternate && spec.type != 0 && spec.type != 'd') {
+        *--text = spec.type;
+        *--text = '0';
+    }
+    text = write_sign(text, spec, negative);
+
+    write_number(out, spec, text, static_cast<std::size_t>(end - text),
+                 static_cast<std::size_t>(digits - text));
+}
+
+/**
+ * @brief Adds one unit in the last place to the decimal digits (and points)
+ *        in [first, last).
+ *
+ * @return bool Whether the carry ran out of the digits, which were all 9.
+ */
+inline bool round_up(char *first, char *last) {
+    while (last != first) {
+        char &digit = *--last;
+
+        if (digit == '.') {
+            continue;
+        }
+        if (digit != '9') {
+            digit++;
+            return false;
+        }
+        digit = '0';
+    }
+    return true;
+}
+
+/**
+ * @brief Drops the trailing zeros of the decimals in [point, last) and the
+ *        point if nothing is left behind it.
+ *
+ * @return char* The new end of the text.
+ */
+inline char *trim_zeros(char *point, char *last) {
+    while (last > point + 1 && last[-1] == '0') {
+        last--;
+    }
+    return last == point + 1 ? point : last;
+}
+
+/**
+ * @brief Formats inf and nan, '0' does not pad them.
+ */
+inline void format_special(Output &out, const Spec &spec, bool negative, bool nan) {
+    char buffer[4];
+    char *const end = buffer + sizeof(buffer);
+    char *const text = write_sign(end - 3, spec, negative);
+
+    std::memcpy(end - 3, nan ? "nan" : "inf", 3);
+    write_padded(out, spec, text, static_cast<std::size_t>(end - text), '>');
+}
+
+/**
+ * @brief Formats mantissa * 2^exponent.
+ *
+ * @details Fixed notation only uses integer arithmetic: the integer part is
+ *          shifted out of the mantissa and every decimal is the integer part
+ *          of ten times the remaining binary fraction, rounded half to even
+ *          at the end. That is exact as long as the fraction has no more than
+ *          60 bits, which covers every float. Numbers beyond 64-bit integers
+ *          are divided by 10 until they fit and shown in exponent notation.
+ */
+inline void format_floating(Output &out, const Spec &spec, bool negative, std::uint64_t mantissa,
+                            int exponent) {
+    const int precision = spec.precision < 0 ? 6 : spec.precision;
+    const bool trim = spec.precision < 0 && spec.type == 0;
+    char buffer[40];
+    // room in front of the point for the sign, a carry and 20 integer digits
+    char *const point = buffer + 24;
+    char *text;
+    char *last;
+
+    if (exponent <= 0 || (exponent < 64 && std::countl_zero(mantissa) >= exponent)) {
+        std::uint64_t integer = mantissa;
+        std::uint64_t fraction = 0;
+        int shift = 0;
+        bool sticky = false;
+
+        if (exponent > 0) {
+            integer = mantissa << exponent;
+        } else if (exponent < 0) {
+            shift = -exponent;
+            integer = shift < 64 ? mantissa >> shift : 0;
+            fraction = shift < 64 ? mantissa & ((1ULL << shift) - 1) : mantissa;
+            // ten times the fraction has to fit 64 bits, remember whether
+            // the bits shifted out were all zero for the rounding
+            if (shift > 60) {
+                const int drop = shift - 60;
+
+                sticky = drop < 64 ? (fraction & ((1ULL << drop) - 1)) != 0 : fraction != 0;
+                fraction = drop < 64 ? fraction >> drop : 0;
+                shift = 60;
+            }
+        }
+
+        for (int i = 1; i <= precision; i++) {
+            fraction *= 10;
+            point[i] = static_cast<char>('0' + (fraction >> shift));
+            fraction &= (1ULL << shift) - 1;
+        }
+
+        *point = '.';
+        text = write_decimal(point, integer);
+        last = point + 1 + precision;
+
+        if (shift > 0) {
+            const std::uint64_t half = 1ULL << (shift - 1);
+            const bool odd = ((precision > 0 ? last[-1] : point[-1]) - '0') % 2 != 0;
+
+            if (fraction > half || (fraction == half && (sticky || odd))) {
+                if (round_up(text, last)) {
+                    *--text = '1';
+                }
+            }
+        }
+
+        if (precision == 0) {
+            last = point;
+        } else if (trim) {
+            last = trim_zeros(point, last);
+        }
+    } else {
+        // every division by 10 loses less than one unit of 64 bits, far
+        // below the 10 digits that are shown
+        int decimal = 0;
+
+        for (;;) {
+            const int normalize = std::countl_zero(mantissa);
+
+            mantissa <<= normalize;
+            exponent -= normalize;
+            if (exponent <= 0) {
+                break;
+            }
+            mantissa /= 10;
+            decimal++;
+        }
+
+        // at least 2^60, so 19 or 20 digits to take the significant ones from
+        char digits[20];
+        char *const first = write_decimal(digits + sizeof(digits), mantissa >> -exponent);
+        int power = decimal + static_cast<int>(digits + sizeof(digits) - first) - 1;
+
+        if (first[precision + 1] >= '5' && round_up(first, first + precision + 1)) {
+            first[0] = '1';
+            power++;
+        }
+
+        text = buffer + 2;
+        last = text;
+        *last++ = first[0];
+        *last++ = '.';
+        std::memcpy(last, first + 1, static_cast<std::size_t>(precision));
+        last += precision;
+        if (precision == 0) {
+            last = text + 1;
+        } else if (trim) {
+            last = trim_zeros(text + 1, last);
+        }
+
+        // an exponent this large is positive and has 2 or 3 digits
+        *last++ = 'e';
+        *last++ = '+';
+        char *const exponent_end = last + (power >= 100 ? 3 : 2);
+        write_decimal(exponent_end, static_cast<std::uint32_t>(power));
+        last = exponent_end;
+    }
+
+    char *const digits = text;
+    text = write_sign(text, spec, negative);
+    write_number(out, spec, text, static_cast<std::size_t>(last - text),
+                 static_cast<std::size_t>(digits - text));
+}
+
+inline void format_arg(Output &out, const Spec &spec, bool value) {
+    if (spec.type == 0 || spec.type == 's') {
+        write_padded(out, spec, value ? "true" : "false", value ? 4 : 5, '<');
+    } else {
+        format_integer(out, spec, value ? 1U : 0U, false);
+    }
+}
+
+inline void format_arg(Output &out, const Spec &spec, char value) {
+    if (spec.type == 0 || spec.type == 'c') {
+        write_padded(out, spec, &value, 1, '<');
+    } else {
+        format_integer(out, spec, static_cast<std::uint32_t>(static_cast<unsigned char>(value)), false);
+    }
+}
+
+inline void format_arg(Output &out, const Spec &spec, std::int32_t value) {
+    const auto magnitude = static_cast<std::uint32_t>(value);
+
+    format_integer(out, spec, value < 0 ? 0U - magnitude : magnitude, value < 0);
+}
+
+inline void format_arg(Output &out, const Spec &spec, std::uint32_t value) {
+    format_integer(out, spec, value, false);
+}
+
+inline void format_arg(Output &out, const Spec &spec, std::int64_t value) {
+    const auto magnitude = static_cast<std::uint64_t>(value);
+
+    format_integer(out, spec, value < 0 ? std::uint64_t{0} - magnitude : magnitude, value < 0);
+}
+
+inline void format_arg(Output &out, const Spec &spec, std::uint64_t value) {
+    format_integer(out, spec, value, false);
+}
+
+inline void format_arg(Output &out, const Spec &spec, float value) {
+    const auto bits = std::bit_cast<std::uint32_t>(value);
+    const bool negative = (bits >> 31) != 0;
+    const auto biased = static_cast<int>((bits >> 23) & 0xFF);
+    std::uint32_t mantissa = bits & 0x7FFFFF;
+
+    if (biased == 0xFF) {
+        format_special(out, spec, negative, mantissa != 0);
+        return;
+    }
+    if (biased != 0) {
+        mantissa |= 1U << 23;
+    }
+    format_floating(out, spec, negative, mantissa, (biased != 0 ? biased : 1) - 150);
+}
+
+inline void format_arg(Output &out, const Spec &spec, double value) {
+    const auto bits = std::bit_cast<std::uint64_t>(value);
+    const bool negative = (bits >> 63) != 0;
+    const auto biased = static_cast<int>((bits >> 52) & 0x7FF);
+    std::uint64_t mantissa = bits & 0xFFFFFFFFFFFFFULL;
+
+    if (biased == 0x7FF) {
+        format_special(out, spec, negative, mantissa != 0);
+        return;
+    }
+    if (biased != 0) {
+        mantissa |= 1ULL << 52;
+    }
+    format_floating(out, spec, negative, mantissa, (biased != 0 ? biased : 1) - 1075);
+}
+
+inline void format_arg(Output &out, const Spec &spec, std::string_view value) {
+    if (spec.precision >= 0 && value.size() > static_cast<std::size_t>(spec.precision)) {
+        value = value.substr(0, static_cast<std::size_t>(spec.precision));
+    }
+    write_padded(out, spec, value.data(), value.size(), '<');
+}
+
+inline void format_arg(Output &out, const Spec &spec, Pointer value) {
+    using Address = std::conditional_t<sizeof(std::uintptr_t) <= 4, std::uint32_t, std::uint64_t>;
+    Spec hex = spec;
+
+    hex.type = 'x';
+    hex.alternate = true;
+    format_integer(out, hex, static_cast<Address>(value.address), false);
+}
+
+/**
+ * @brief Converts an argument to the type its Kind is formatted from.
+ */
+template <typename T>
+auto normalize(const T &value) {
+    using U = std::remove_cvref_t<T>;
+    constexpr Kind kind = kind_of<T>();
+
+    if constexpr (kind == Kind::Bool || kind == Kind::Char) {
+        return static_cast<U>(value);
+    } else if constexpr (kind == Kind::Int32) {
+        return static_cast<std::int32_t>(value);
+    } else if constexpr (kind == Kind::UInt32) {
+        return static_cast<std::uint32_t>(value);
+    } else if constexpr (kind == Kind::Int64) {
+        return static_cast<std::int64_t>(value);
+    } else if constexpr (kind == Kind::UInt64) {
+        return static_cast<std::uint64_t>(value);
+    } else if constexpr (kind == Kind::Float) {
+        return value;
+    } else if constexpr (kind == Kind::Double) {
+        return static_cast<double>(value);
+    } else if constexpr (kind == Kind::String) {
+        return std::string_view{value};
+    } else if constexpr (std::is_null_pointer_v<U>) {
+        return Pointer{0};
+    } else {
+        return Pointer{reinterpret_cast<std::uintptr_t>(value)};
+    }
+}
+
+inline void write_piece(Output &out, const char *text, Piece piece) {
+    const char *const data = text + piece.offset;
+
+    if (!piece.escaped) {
+        out.write(data, piece.length);
+        return;
+    }
+
+    // every brace in the piece is doubled
+    for (std::size_t i = 0; i < piece.length; i++) {
+        out.put(data[i]);
+        if (data[i] == '{' || data[i] == '}') {
+            i++;
+        }
+    }
+}
+
+template <typename... Args, std::size_t... I>
+void format_args(Output &out, const FormatString<Args...> &format, std::index_sequence<I...>,
+                 const Args &...args) {
+    ((write_piece(out, format.text, format.pieces[I]), format_arg(out, format.specs[I], normalize(args))),
+     ...);
+    write_piece(out, format.text, format.pieces[sizeof...(Args)]);
+}
+
+template <typename Sink, typename... Args>
+std::size_t format_to_sink(Sink &sink, bool newline, const FormatString<Args...> &format,
+                           const Args &...args) {
+    auto call = [&sink](const char *data, std::size_t size) { sink(data, size); };
+    char buffer[TM4C_FORMAT_BUFFER];
+    Output out{buffer, sizeof(buffer),
+               [](Output &output) { (*static_cast<decltype(call) *>(output.context()))(output.data(), output.used()); },
+               &call};
+
+    format_args(out, format, std::index_sequence_for<Args...>{}, args...);
+    if (newline) {
+        out.put('\n');
+    }
+    out.flush();
+
+    return out.size();
+}
+
+inline void write_stdout(const char *data, std::size_t size) {
+    [[maybe_unused]] const auto written = ::write(STDOUT_FILENO, data, size);
+}
+
+} // namespace format_detail
+
+/**
+ * @brief Formats the arguments and hands the text to sink(const char *data,
+ *        std::size_t size), in chunks of at most TM4C_FORMAT_BUFFER bytes.
+ *
+ * @return std::size_t The length of the text.
+ */
+template <typename Sink, typename... Args>
+std::size_t format_to(Sink &&sink, FormatString<std::type_identity_t<Args>...> format,
+                      const Args &...args) {
+    return format_detail::format_to_sink(sink, false, format, args...);
+}
+
+/**
+ * @brief Formats into a buffer like snprintf: at most size - 1 characters
+ *        and a terminating NUL.
+ *
+ * @return std::size_t The length of the whole text, even if it was cut off.
+ */
+template <typename... Args>
+std::size_t snformat(char *buffer, std::size_t size, FormatString<std::type_identity_t<Args>...> format,
+                     const Args &...args) {
+    Output out{buffer, size > 0 ? size - 1 : 0};
+
+    format_detail::format_args(out, format, std::index_sequence_for<Args...>{}, args...);
+    if (size > 0) {
+        buffer[out.used()] = '\0';
+    }
+
+    return out.size();
+}
+
+/**
+ * @brief Formats to stdout.
+ */
+template <typename... Args>
+std::size_t print(FormatString<std::type_identity_t<Args>...> format, const Args &...args) {
+    return format_detail::format_to_sink(format_detail::write_stdout, false, format, args...);
+}
+
+/**
+ * @brief Formats to stdout and ends the line.
+ */
+template <typename... Args>
+std::size_t println(FormatString<std::type_identity_t<Args>...> format, const Args &...args) {
+    return format_detail::format_to_sink(format_detail::write_stdout, true, format, args...);
+}
+
+} // namespace tm4c
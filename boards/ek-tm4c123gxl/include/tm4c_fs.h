@@ -0,0 +1,156 @@
+/**
+ * @file tm4c_fs.h
+ * @author Esteban Duran (@astroesteban)
+ * @brief A small log-structured filesystem in the top TM4C_FS_SIZE bytes of
+ *        the internal flash, behind open(), read(), write(), lseek(),
+ *        unlink() and stat() (and so behind fopen() and std::fstream).
+ *
+ * @details The region is a log of 1 KB erase blocks. Every change is a record
+ *          appended to the newest block: a file is created (or truncated)
+ *          with its name and a new generation number, gets data records with
+ *          the offset they belong at, and is deleted with a delete record.
+ *          Nothing is ever written twice, so an append only programs the
+ *          words it adds, however small it is.
+ *
+ *          Each record ends in a CRC-32 that is programmed last. A record is
+ *          committed once the CRC matches, a write cut short by a reset is
+ *          found and dropped on the next mount. Truncating, creating and
+ *          deleting are single records, so they happen completely or not at
+ *          all. Overwriting data in the middle of a file copies the file
+ *          into a new generation that only becomes the file with the final
+ *          create record.
+ *
+ *          Before the last two free blocks are taken, the garbage collector
+ *          copies the records still in use out of the oldest block and
+ *          erases it. One of the two is what it copies to, the other one
+ *          lets a full filesystem still delete and truncate files. The log
+ *          thus moves through the whole region, static files included, and
+ *          new blocks are taken from the free ones erased the fewest times,
+ *          which levels the wear across all blocks.
+ *          Erase counts are kept in the block headers.
+ *
+ *          Names are flat (no directories) and at most TM4C_FS_NAME_MAX
+ *          bytes. The filesystem is not reentrant, use it from one context.
+ *          Flash operations stall the core (including interrupts running
+ *          from flash) for up to 10 ms per erase.
+ *
+ *          The functions return a negative errno value on failure. The
+ *          system calls in syscalls.c turn those into errno and -1.
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @ref TM4C123GH6PM datasheet section 8.2.3 (Flash Memory Programming)
+ *
+ * @copyright Apache License
+ *
+ */
+#ifndef TM4C_FS_H
+#define TM4C_FS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/stat.h>
+
+/* Bytes of flash at its top reserved for the filesystem (cmake option) */
+#ifndef TM4C_FS_SIZE
+#define TM4C_FS_SIZE 32768
+#endif
+
+/* Files that can exist at the same time */
+#ifndef TM4C_FS_MAX_FILES
+#define TM4C_FS_MAX_FILES 16
+#endif
+
+/* Files that can be open at the same time */
+#ifndef TM4C_FS_MAX_OPEN
+#define TM4C_FS_MAX_OPEN 4
+#endif
+
+#define TM4C_FS_BLOCK_SIZE 1024     // the erase size of the flash
+#define TM4C_FS_BLOCKS (TM4C_FS_SIZE / TM4C_FS_BLOCK_SIZE)
+#define TM4C_FS_NAME_MAX 32         // bytes of a file name
+#define TM4C_FS_FD_FIRST 3          // file descriptors after stdin, stdout and stderr
+
+/**
+ * @brief Usage and wear of the filesystem.
+ */
+typedef struct {
+    uint32_t files;
+    uint32_t live_bytes;            // records still in use, headers included
+    uint32_t free_bytes;            // what can be written before garbage is collected
+    uint32_t min_erase_count;
+    uint32_t max_erase_count;
+} tm4c_fs_stats_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Reads the log back from flash, formats blocks that do not belong to
+ *        the filesystem and drops writes a reset cut short. The first file
+ *        operation does this on its own, calling it again (e.g. after a
+ *        simulated reset) closes all files.
+ *
+ * @return int 0 or -EIO.
+ */
+int tm4c_fs_mount(void);
+
+/**
+ * @brief Deletes all files. The erase counts are kept.
+ *
+ * @return int 0 or -EIO.
+ */
+int tm4c_fs_format(void);
+
+/**
+ * @brief Opens a file. Takes O_RDONLY, O_WRONLY or O_RDWR and O_CREAT,
+ *        O_EXCL, O_TRUNC and O_APPEND.
+ *
+ * @return int The file descriptor (TM4C_FS_FD_FIRST or above), -ENOENT,
+ *         -EEXIST, -ENAMETOOLONG, -EMFILE, -ENOSPC or -EIO.
+ */
+int tm4c_fs_open(const char *name, int flags);
+
+int tm4c_fs_close(int fd);
+
+/**
+ * @return int The number of bytes read, 0 at the end of the file.
+ */
+int tm4c_fs_read(int fd, void *data, size_t size);
+
+/**
+ * @brief Writes at the file position, or at the end with O_APPEND. Writing
+ *        in front of the end copies the whole file.
+ *
+ * @return int The number of bytes written, less than size only if the
+ *         filesystem filled up on the way.
+ */
+int tm4c_fs_write(int fd, const void *data, size_t size);
+
+/**
+ * @return int The new file position. Positions past the end are allowed,
+ *         the gap reads as zeros once written behind.
+ */
+int tm4c_fs_lseek(int fd, int offset, int whence);
+
+/**
+ * @return int 0, -ENOENT or -EBUSY if the file is open.
+ */
+int tm4c_fs_unlink(const char *name);
+
+int tm4c_fs_stat(const char *name, struct stat *st);
+int tm4c_fs_fstat(int fd, struct stat *st);
+
+/**
+ * @brief Counts the files and bytes in use and the erase counts of the
+ *        blocks.
+ */
+int tm4c_fs_stats(tm4c_fs_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TM4C_FS_H
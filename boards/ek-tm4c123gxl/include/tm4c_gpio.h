@@ -0,0 +1,61 @@
+/**
+ * @file tm4c_gpio.h
+ * @author Esteban Duran (@astroesteban)
+ * @brief The bus every GPIO port is accessed through and its base address.
+ *
+ * @details Every port can be reached through the legacy APB aperture or the
+ *          Advanced High-Performance Bus, one of them at a time as GPIOHBCTL
+ *          selects. An access through the other aperture faults. The
+ *          TM4C_GPIO_AHB_PORTS option (bit n = port A + n) picks the AHB
+ *          ports at compile time: startup programs GPIOHBCTL with it before
+ *          anything touches a port, and TM4C_GPIO_BASE() resolves to the
+ *          matching base address, so no access needs a runtime branch.
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @ref TM4C123GH6PM datasheet section 10.3 (Initialization and Configuration)
+ *      and 5.5 (GPIOHBCTL)
+ *
+ * @copyright Apache License
+ *
+ */
+#ifndef TM4C_GPIO_H
+#define TM4C_GPIO_H
+
+#include <stdint.h>
+
+#ifndef TM4C_GPIO_AHB_PORTS
+#define TM4C_GPIO_AHB_PORTS 0U
+#endif
+
+#define TM4C_SYSCTL_GPIOHBCTL (*((volatile uint32_t *)0x400FE06C)) // GPIO High-Performance Bus Control
+
+#define TM4C_GPIO_PORTS_M     0x3FU     // ports A-F
+
+/* port 0-5 (A-F). A-D follow each other on the APB, E and F are further up */
+#define TM4C_GPIO_APB_BASE(port) \
+    ((port) < 4U ? 0x40004000UL + (port) * 0x1000UL : 0x40024000UL + ((port) - 4U) * 0x1000UL)
+#define TM4C_GPIO_AHB_BASE(port) (0x40058000UL + (port) * 0x1000UL)
+
+/* the base address of a port on the bus TM4C_GPIO_AHB_PORTS selects */
+#define TM4C_GPIO_BASE(port) \
+    (((TM4C_GPIO_AHB_PORTS >> (port)) & 1U) != 0U ? TM4C_GPIO_AHB_BASE(port) : TM4C_GPIO_APB_BASE(port))
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Moves the ports in TM4C_GPIO_AHB_PORTS to the AHB and the others to
+ *        the APB. Called by the startup code before main().
+ */
+static inline void tm4c_gpio_bus_init(void) {
+    TM4C_SYSCTL_GPIOHBCTL = (TM4C_SYSCTL_GPIOHBCTL & ~TM4C_GPIO_PORTS_M) | (TM4C_GPIO_AHB_PORTS & TM4C_GPIO_PORTS_M);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TM4C_GPIO_H
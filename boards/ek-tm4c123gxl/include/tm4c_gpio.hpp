@@ -0,0 +1,192 @@
+/**
+ * @file tm4c_gpio.hpp
+ * @author Esteban Duran (@astroesteban)
+ * @brief GPIO pins that change with a single store, without read-modify-write.
+ *
+ * @details The GPIODATA register of a port is mirrored over 256 words. Bits
+ *          [9:2] of the address a store goes to select the pins it changes,
+ *          all others keep their level; a load through the same address
+ *          reads the selected pins and zeros. DATA at offset 0x3FC is the
+ *          alias that selects all eight pins.
+ *
+ *          tm4c::gpio::PinGroup<Port, Mask> knows its alias at compile time,
+ *          so set(), clear() and write() are one store that changes nothing
+ *          but the group's pins. They need no critical section, an ISR
+ *          driving other pins of the same port is never overwritten:
+ *
+ * @code
+ * using Led = tm4c::gpio::Pin<tm4c::gpio::Port::F, 1>;
+ * using Rgb = tm4c::gpio::PinGroup<tm4c::gpio::Port::F, 0x0E>;
+ *
+ * Rgb::enable();
+ * Rgb::make_output();
+ * Rgb::write(0x04);        // blue on, red and green off, PF0 and PF4 untouched
+ * Led::set();              // red on as well
+ * @endcode
+ *
+ *          toggle() reads and writes the alias, so it only races with code
+ *          that drives the same pins. The set up functions (enable(),
+ *          make_output(), make_input()) modify registers the whole port
+ *          shares and belong before interrupts use the port.
+ *
+ *          A port is accessed through the APB or the AHB aperture (see
+ *          tm4c_gpio.h). The bus is a template parameter that defaults to
+ *          the one the TM4C_GPIO_AHB_PORTS option selects, every address is
+ *          resolved at compile time.
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @ref TM4C123GH6PM datasheet section 10.2.1.2 (Data Register Operation)
+ *
+ * @copyright Apache License
+ *
+ */
+#pragma once
+
+#include <cstdint>
+
+#include "tm4c_gpio.h"
+#include "tm4c_register.hpp"
+
+namespace tm4c::gpio {
+
+enum class Port : std::uint32_t { A, B, C, D, E, F };
+
+enum class Pull { None, Up, Down };
+
+/// The aperture a port is accessed through, the AHB toggles pins faster
+enum class Bus { APB, AHB };
+
+/**
+ * @brief The bus the TM4C_GPIO_AHB_PORTS option puts the port on.
+ */
+constexpr Bus default_bus(Port port) {
+    return ((TM4C_GPIO_AHB_PORTS >> static_cast<std::uint32_t>(port)) & 1U) != 0 ? Bus::AHB : Bus::APB;
+}
+
+/**
+ * @brief The base address of a port on a bus.
+ */
+constexpr std::uint32_t base(Port port, Bus bus = Bus::APB) {
+    constexpr std::uint32_t apb[] = {0x40004000, 0x40005000, 0x40006000, 0x40007000, 0x40024000, 0x40025000};
+    const auto index = static_cast<std::uint32_t>(port);
+    return bus == Bus::AHB ? 0x40058000 + index * 0x1000 : apb[index];
+}
+
+/**
+ * @brief The GPIODATA alias that selects the pins in mask.
+ */
+constexpr std::uint32_t data_address(Port port, std::uint32_t mask, Bus bus = Bus::APB) {
+    return base(port, bus) + (mask << 2);
+}
+
+/**
+ * @brief The pins in Mask of one port, accessed through bus B.
+ */
+template <Port P, std::uint32_t Mask, Bus B = default_bus(P)>
+struct PinGroup {
+    static_assert(Mask > 0 && Mask <= 0xFF, "A port has 8 pins");
+
+    static constexpr Port port = P;
+    static constexpr std::uint32_t mask = Mask;
+    static constexpr Bus bus = B;
+    static constexpr std::uint32_t address = data_address(P, Mask, B);
+
+    using Data = Register<address>;
+
+    /// Drives the pins high
+    [[gnu::always_inline]] static void set() noexcept { Data::write(Mask); }
+
+    /// Drives the pins low
+    [[gnu::always_inline]] static void clear() noexcept { Data::write(0); }
+
+    /// Drives the pins to the bits of value in the group, ignores the others
+    [[gnu::always_inline]] static void write(std::uint32_t value) noexcept { Data::write(value); }
+
+    /// The level of the pins, the bits of other pins are zero
+    [[gnu::always_inline]] static std::uint32_t read() noexcept { return Data::read(); }
+
+    /// Inverts the pins with a load and a store of the alias
+    [[gnu::always_inline]] static void toggle() noexcept { Data::write(~Data::read()); }
+
+    /**
+     * @brief Starts the clock of the port and waits until it is ready.
+     */
+    static void enable() noexcept {
+        constexpr std::uint32_t bit = 1U << static_cast<std::uint32_t>(P);
+        Register<0x400FE608>::set(bit);                     // RCGCGPIO
+        while ((Register<0x400FEA08, Access::ReadOnly>::read() & bit) == 0) {   // PRGPIO
+        }
+    }
+
+    /**
+     * @brief Moves the whole port to bus B at runtime. Startup already put it
+     *        on default_bus(P), this is for code that compares the buses.
+     *        Groups of the port on the other bus fault from now on.
+     */
+    static void use_bus() noexcept {
+        constexpr std::uint32_t bit = 1U << static_cast<std::uint32_t>(P);
+        if constexpr (B == Bus::AHB) {
+            Register<0x400FE06C>::set(bit);                 // GPIOHBCTL
+        } else {
+            Register<0x400FE06C>::clear(bit);
+        }
+    }
+
+    static void make_output() noexcept {
+        unlock();
+        Register<base(P, B) + 0x420>::clear(Mask);          // AFSEL
+        Register<base(P, B) + 0x528>::clear(Mask);          // AMSEL
+        Register<base(P, B) + 0x400>::set(Mask);            // DIR
+        Register<base(P, B) + 0x51C>::set(Mask);            // DEN
+    }
+
+    static void make_input(Pull pull = Pull::None) noexcept {
+        unlock();
+        Register<base(P, B) + 0x420>::clear(Mask);          // AFSEL
+        Register<base(P, B) + 0x528>::clear(Mask);          // AMSEL
+        Register<base(P, B) + 0x400>::clear(Mask);          // DIR
+        if (pull == Pull::Up) {
+            Register<base(P, B) + 0x510>::set(Mask);        // PUR
+        } else if (pull == Pull::Down) {
+            Register<base(P, B) + 0x514>::set(Mask);        // PDR
+        } else {
+            Register<base(P, B) + 0x510>::clear(Mask);
+            Register<base(P, B) + 0x514>::clear(Mask);
+        }
+        Register<base(P, B) + 0x51C>::set(Mask);            // DEN
+    }
+
+private:
+    /// PC0-3 (JTAG), PD7 and PF0 (NMI) need GPIOLOCK unlocked and GPIOCR set
+    static constexpr std::uint32_t locked = P == Port::C ? 0x0F : P == Port::D ? 0x80 : P == Port::F ? 0x01 : 0;
+
+    static void unlock() noexcept {
+        if constexpr ((Mask & locked) != 0) {
+            Register<base(P, B) + 0x520>::write(0x4C4F434B);   // LOCK
+            Register<base(P, B) + 0x524>::set(Mask & locked);  // CR
+        }
+    }
+};
+
+/**
+ * @brief Pin N of one port.
+ */
+template <Port P, unsigned N, Bus B = default_bus(P)>
+struct Pin : PinGroup<P, 1U << N, B> {
+    static_assert(N < 8, "A port has 8 pins");
+
+    static constexpr unsigned number = N;
+
+    /// Drives the pin high or low
+    [[gnu::always_inline]] static void write(bool high) noexcept {
+        PinGroup<P, 1U << N, B>::write(high ? 0xFFU : 0U);
+    }
+
+    [[gnu::always_inline]] static bool is_high() noexcept {
+        return PinGroup<P, 1U << N, B>::read() != 0;
+    }
+};
+
+} // namespace tm4c::gpio
@@ -0,0 +1,47 @@
+/**
+ * @file tm4c_heap.h
+ * @author Esteban Duran (@astroesteban)
+ * @brief Statistics of the heap _sbrk hands out to malloc.
+ *
+ * @details The heap is a fixed region between .bss and the stack defined by
+ *          the linker script. Its size is set with the TM4C_HEAP_SIZE CMake
+ *          option and the linker makes sure TM4C_MIN_STACK_SIZE bytes below
+ *          the initial stack pointer stay free for the stack.
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#ifndef TM4C_HEAP_H
+#define TM4C_HEAP_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Usage of the heap region. The sizes are what malloc obtained through
+ *        _sbrk, memory malloc holds in its free lists counts as used.
+ */
+typedef struct {
+    size_t size;            // bytes currently handed out by _sbrk
+    size_t peak;            // largest size since boot
+    size_t capacity;        // size of the heap region
+    uint32_t failed;        // _sbrk requests that were refused
+} tm4c_heap_stats_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Returns a snapshot of the heap statistics.
+ */
+tm4c_heap_stats_t tm4c_heap_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TM4C_HEAP_H
@@ -0,0 +1,187 @@
+/**
+ * @file tm4c_interrupts.h
+ * @author Esteban Duran (@astroesteban)
+ * @brief Interrupt numbers, NVIC helpers and, when the vector table is
+ *        relocated to SRAM (TM4C_RAM_VECTORS), attaching handlers at runtime.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#ifndef TM4C_INTERRUPTS_H
+#define TM4C_INTERRUPTS_H
+
+#include <stdint.h>
+
+#define TM4C_NVIC_EN0       0xE000E100UL    // Interrupt 0-31 Set Enable
+#define TM4C_NVIC_DIS0      0xE000E180UL    // Interrupt 0-31 Clear Enable
+#define TM4C_NVIC_PRI0      0xE000E400UL    // Interrupt 0-3 Priority
+#define TM4C_NVIC_SW_TRIG   (*((volatile uint32_t *)0xE000EF00)) // Software Trigger Interrupt
+#define TM4C_SCB_VTOR       (*((volatile uint32_t *)0xE000ED08)) // Vector Table Offset
+
+/* The TM4C123 implements the upper 3 bits of each priority byte */
+#define TM4C_PRIORITY_BITS  3
+
+/* Number of entries in the vector table, the stack pointer included */
+#define TM4C_VECTOR_COUNT   155
+
+/**
+ * @brief Interrupt numbers as used by the NVIC. The system exceptions are
+ *        negative (vector number - 16), just like CMSIS does it.
+ */
+typedef enum {
+    TM4C_IRQ_NMI =                 -14,
+    TM4C_IRQ_HARD_FAULT =          -13,
+    TM4C_IRQ_MEM_MANAGE_FAULT =    -12,
+    TM4C_IRQ_BUS_FAULT =           -11,
+    TM4C_IRQ_USAGE_FAULT =         -10,
+    TM4C_IRQ_SVC =                  -5,
+    TM4C_IRQ_DEBUG_MONITOR =        -4,
+    TM4C_IRQ_PENDSV =               -2,
+    TM4C_IRQ_SYSTICK =              -1,
+    TM4C_IRQ_GPIO_PORT_A =           0,
+    TM4C_IRQ_GPIO_PORT_B =           1,
+    TM4C_IRQ_GPIO_PORT_C =           2,
+    TM4C_IRQ_GPIO_PORT_D =           3,
+    TM4C_IRQ_GPIO_PORT_E =           4,
+    TM4C_IRQ_UART0 =                 5,
+    TM4C_IRQ_UART1 =                 6,
+    TM4C_IRQ_SPI0 =                  7,
+    TM4C_IRQ_I2C0 =                  8,
+    TM4C_IRQ_PWM0_FAULT =            9,
+    TM4C_IRQ_PWM0_GENERATOR0 =      10,
+    TM4C_IRQ_PWM0_GENERATOR1 =      11,
+    TM4C_IRQ_PWM0_GENERATOR2 =      12,
+    TM4C_IRQ_QEI0 =                 13,
+    TM4C_IRQ_ADC0_SEQUENCE0 =       14,
+    TM4C_IRQ_ADC0_SEQUENCE1 =       15,
+    TM4C_IRQ_ADC0_SEQUENCE2 =       16,
+    TM4C_IRQ_ADC0_SEQUENCE3 =       17,
+    TM4C_IRQ_WATCHDOG_TIMER =       18,
+    TM4C_IRQ_TIMER0A =              19,
+    TM4C_IRQ_TIMER0B =              20,
+    TM4C_IRQ_TIMER1A =              21,
+    TM4C_IRQ_TIMER1B =              22,
+    TM4C_IRQ_TIMER2A =              23,
+    TM4C_IRQ_TIMER2B =              24,
+    TM4C_IRQ_ANALOG_COMPARATOR0 =   25,
+    TM4C_IRQ_ANALOG_COMPARATOR1 =   26,
+    TM4C_IRQ_SYSTEM_CTRL =          28,
+    TM4C_IRQ_FLASH_CTRL =           29,
+    TM4C_IRQ_GPIO_PORT_F =          30,
+    TM4C_IRQ_UART2 =                33,
+    TM4C_IRQ_SPI1 =                 34,
+    TM4C_IRQ_TIMER3A =              35,
+    TM4C_IRQ_TIMER3B =              36,
+    TM4C_IRQ_I2C1 =                 37,
+    TM4C_IRQ_QEI1 =                 38,
+    TM4C_IRQ_CAN0 =                 39,
+    TM4C_IRQ_CAN1 =                 40,
+    TM4C_IRQ_HIBERNATION =          43,
+    TM4C_IRQ_USB0 =                 44,
+    TM4C_IRQ_PWM0_GENERATOR3 =      45,
+    TM4C_IRQ_UDMA_SOFTWARE =        46,
+    TM4C_IRQ_UDMA_ERROR =           47,
+    TM4C_IRQ_ADC1_SEQUENCE0 =       48,
+    TM4C_IRQ_ADC1_SEQUENCE1 =       49,
+    TM4C_IRQ_ADC1_SEQUENCE2 =       50,
+    TM4C_IRQ_ADC1_SEQUENCE3 =       51,
+    TM4C_IRQ_SPI2 =                 57,
+    TM4C_IRQ_SPI3 =                 58,
+    TM4C_IRQ_UART3 =                59,
+    TM4C_IRQ_UART4 =                60,
+    TM4C_IRQ_UART5 =                61,
+    TM4C_IRQ_UART6 =                62,
+    TM4C_IRQ_UART7 =                63,
+    TM4C_IRQ_I2C2 =                 68,
+    TM4C_IRQ_I2C3 =                 69,
+    TM4C_IRQ_TIMER4A =              70,
+    TM4C_IRQ_TIMER4B =              71,
+    TM4C_IRQ_TIMER5A =              92,
+    TM4C_IRQ_TIMER5B =              93,
+    TM4C_IRQ_WIDE_TIMER0A =         94,
+    TM4C_IRQ_WIDE_TIMER0B =         95,
+    TM4C_IRQ_WIDE_TIMER1A =         96,
+    TM4C_IRQ_WIDE_TIMER1B =         97,
+    TM4C_IRQ_WIDE_TIMER2A =         98,
+    TM4C_IRQ_WIDE_TIMER2B =         99,
+    TM4C_IRQ_WIDE_TIMER3A =        100,
+    TM4C_IRQ_WIDE_TIMER3B =        101,
+    TM4C_IRQ_WIDE_TIMER4A =        102,
+    TM4C_IRQ_WIDE_TIMER4B =        103,
+    TM4C_IRQ_WIDE_TIMER5A =        104,
+    TM4C_IRQ_WIDE_TIMER5B =        105,
+    TM4C_IRQ_SYSTEM_EXCEPTION =    106,
+    TM4C_IRQ_PWM1_GENERATOR0 =     134,
+    TM4C_IRQ_PWM1_GENERATOR1 =     135,
+    TM4C_IRQ_PWM1_GENERATOR2 =     136,
+    TM4C_IRQ_PWM1_GENERATOR3 =     137,
+    TM4C_IRQ_PWM1_FAULT =          138,
+} tm4c_irq_t;
+
+/* Defines a type for interrupt handlers */
+typedef void (*tm4c_isr_t)(void);
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Enables the interrupt in the NVIC. Only valid for irq >= 0.
+ */
+static inline void tm4c_irq_enable(tm4c_irq_t irq) {
+    ((volatile uint32_t *)TM4C_NVIC_EN0)[(uint32_t)irq / 32] = 1UL << ((uint32_t)irq % 32);
+}
+
+/**
+ * @brief Disables the interrupt in the NVIC. Only valid for irq >= 0.
+ */
+static inline void tm4c_irq_disable(tm4c_irq_t irq) {
+    ((volatile uint32_t *)TM4C_NVIC_DIS0)[(uint32_t)irq / 32] = 1UL << ((uint32_t)irq % 32);
+    __asm volatile ("dsb\n\tisb" ::: "memory");
+}
+
+/**
+ * @brief Pends the interrupt from software. Only valid for irq >= 0.
+ */
+static inline void tm4c_irq_pend(tm4c_irq_t irq) {
+    TM4C_NVIC_SW_TRIG = (uint32_t)irq;
+    __asm volatile ("dsb\n\tisb" ::: "memory");
+}
+
+/**
+ * @brief Sets the priority (0 = most urgent, 7 = least urgent) of the
+ *        interrupt. Only valid for irq >= 0.
+ */
+static inline void tm4c_irq_set_priority(tm4c_irq_t irq, uint8_t priority) {
+    ((volatile uint8_t *)TM4C_NVIC_PRI0)[(uint32_t)irq] =
+        (uint8_t)(priority << (8 - TM4C_PRIORITY_BITS));
+}
+
+#if defined(TM4C_RAM_VECTORS)
+/**
+ * @brief Installs a handler in the SRAM copy of the vector table.
+ *
+ * @details The slot is written with a single store, so swapping the handler
+ *          of an enabled interrupt is safe: the NVIC either fetches the old
+ *          or the new handler. Only available with TM4C_RAM_VECTORS.
+ *
+ * @param irq The interrupt or system exception to attach to.
+ * @param handler The new handler.
+ * @return tm4c_isr_t The handler that was installed before, or 0 if irq is
+ *         out of range.
+ */
+tm4c_isr_t tm4c_irq_attach(tm4c_irq_t irq, tm4c_isr_t handler);
+
+/**
+ * @brief Returns the handler currently installed for the interrupt.
+ */
+tm4c_isr_t tm4c_irq_handler(tm4c_irq_t irq);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TM4C_INTERRUPTS_H
@@ -0,0 +1,161 @@
+/**
+ * @file tm4c_interrupts.hpp
+ * @author Esteban Duran (@astroesteban)
+ * @brief Type-safe C++ wrapper of tm4c_interrupts.h. With TM4C_RAM_VECTORS a
+ *        driver can install one of its static member functions directly in
+ *        the vector table instead of going through a free function:
+ *
+ * @code
+ * class Uart {
+ * public:
+ *     void start() { tm4c::attach(tm4c::Irq::UART0, &Uart::isr); }
+ * private:
+ *     static void isr();
+ * };
+ * @endcode
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#pragma once
+
+#include <cstdint>
+
+#include "tm4c_interrupts.h"
+
+namespace tm4c {
+
+/**
+ * @brief Interrupt numbers, see tm4c_irq_t.
+ */
+enum class Irq : std::int32_t {
+    NMI =                   TM4C_IRQ_NMI,
+    HardFault =             TM4C_IRQ_HARD_FAULT,
+    MemManageFault =        TM4C_IRQ_MEM_MANAGE_FAULT,
+    BusFault =              TM4C_IRQ_BUS_FAULT,
+    UsageFault =            TM4C_IRQ_USAGE_FAULT,
+    SVC =                   TM4C_IRQ_SVC,
+    DebugMonitor =          TM4C_IRQ_DEBUG_MONITOR,
+    PendSV =                TM4C_IRQ_PENDSV,
+    SysTick =               TM4C_IRQ_SYSTICK,
+    GPIOPortA =             TM4C_IRQ_GPIO_PORT_A,
+    GPIOPortB =             TM4C_IRQ_GPIO_PORT_B,
+    GPIOPortC =             TM4C_IRQ_GPIO_PORT_C,
+    GPIOPortD =             TM4C_IRQ_GPIO_PORT_D,
+    GPIOPortE =             TM4C_IRQ_GPIO_PORT_E,
+    UART0 =                 TM4C_IRQ_UART0,
+    UART1 =                 TM4C_IRQ_UART1,
+    SPI0 =                  TM4C_IRQ_SPI0,
+    I2C0 =                  TM4C_IRQ_I2C0,
+    PWM0Fault =             TM4C_IRQ_PWM0_FAULT,
+    PWM0Generator0 =        TM4C_IRQ_PWM0_GENERATOR0,
+    PWM0Generator1 =        TM4C_IRQ_PWM0_GENERATOR1,
+    PWM0Generator2 =        TM4C_IRQ_PWM0_GENERATOR2,
+    QEI0 =                  TM4C_IRQ_QEI0,
+    ADC0Sequence0 =         TM4C_IRQ_ADC0_SEQUENCE0,
+    ADC0Sequence1 =         TM4C_IRQ_ADC0_SEQUENCE1,
+    ADC0Sequence2 =         TM4C_IRQ_ADC0_SEQUENCE2,
+    ADC0Sequence3 =         TM4C_IRQ_ADC0_SEQUENCE3,
+    WatchDogTimer =         TM4C_IRQ_WATCHDOG_TIMER,
+    Timer0A =               TM4C_IRQ_TIMER0A,
+    Timer0B =               TM4C_IRQ_TIMER0B,
+    Timer1A =               TM4C_IRQ_TIMER1A,
+    Timer1B =               TM4C_IRQ_TIMER1B,
+    Timer2A =               TM4C_IRQ_TIMER2A,
+    Timer2B =               TM4C_IRQ_TIMER2B,
+    AnalogComparator0 =     TM4C_IRQ_ANALOG_COMPARATOR0,
+    AnalogComparator1 =     TM4C_IRQ_ANALOG_COMPARATOR1,
+    SystemCtrl =            TM4C_IRQ_SYSTEM_CTRL,
+    FlashCtrl =             TM4C_IRQ_FLASH_CTRL,
+    GPIOPortF =             TM4C_IRQ_GPIO_PORT_F,
+    UART2 =                 TM4C_IRQ_UART2,
+    SPI1 =                  TM4C_IRQ_SPI1,
+    Timer3A =               TM4C_IRQ_TIMER3A,
+    Timer3B =               TM4C_IRQ_TIMER3B,
+    I2C1 =                  TM4C_IRQ_I2C1,
+    QEI1 =                  TM4C_IRQ_QEI1,
+    CAN0 =                  TM4C_IRQ_CAN0,
+    CAN1 =                  TM4C_IRQ_CAN1,
+    Hibernation =           TM4C_IRQ_HIBERNATION,
+    USB0 =                  TM4C_IRQ_USB0,
+    PWM0Generator3 =        TM4C_IRQ_PWM0_GENERATOR3,
+    UDMASoftware =          TM4C_IRQ_UDMA_SOFTWARE,
+    UDMAError =             TM4C_IRQ_UDMA_ERROR,
+    ADC1Sequence0 =         TM4C_IRQ_ADC1_SEQUENCE0,
+    ADC1Sequence1 =         TM4C_IRQ_ADC1_SEQUENCE1,
+    ADC1Sequence2 =         TM4C_IRQ_ADC1_SEQUENCE2,
+    ADC1Sequence3 =         TM4C_IRQ_ADC1_SEQUENCE3,
+    SPI2 =                  TM4C_IRQ_SPI2,
+    SPI3 =                  TM4C_IRQ_SPI3,
+    UART3 =                 TM4C_IRQ_UART3,
+    UART4 =                 TM4C_IRQ_UART4,
+    UART5 =                 TM4C_IRQ_UART5,
+    UART6 =                 TM4C_IRQ_UART6,
+    UART7 =                 TM4C_IRQ_UART7,
+    I2C2 =                  TM4C_IRQ_I2C2,
+    I2C3 =                  TM4C_IRQ_I2C3,
+    Timer4A =               TM4C_IRQ_TIMER4A,
+    Timer4B =               TM4C_IRQ_TIMER4B,
+    Timer5A =               TM4C_IRQ_TIMER5A,
+    Timer5B =               TM4C_IRQ_TIMER5B,
+    WideTimer0A =           TM4C_IRQ_WIDE_TIMER0A,
+    WideTimer0B =           TM4C_IRQ_WIDE_TIMER0B,
+    WideTimer1A =           TM4C_IRQ_WIDE_TIMER1A,
+    WideTimer1B =           TM4C_IRQ_WIDE_TIMER1B,
+    WideTimer2A =           TM4C_IRQ_WIDE_TIMER2A,
+    WideTimer2B =           TM4C_IRQ_WIDE_TIMER2B,
+    WideTimer3A =           TM4C_IRQ_WIDE_TIMER3A,
+    WideTimer3B =           TM4C_IRQ_WIDE_TIMER3B,
+    WideTimer4A =           TM4C_IRQ_WIDE_TIMER4A,
+    WideTimer4B =           TM4C_IRQ_WIDE_TIMER4B,
+    WideTimer5A =           TM4C_IRQ_WIDE_TIMER5A,
+    WideTimer5B =           TM4C_IRQ_WIDE_TIMER5B,
+    SystemException =       TM4C_IRQ_SYSTEM_EXCEPTION,
+    PWM1Generator0 =        TM4C_IRQ_PWM1_GENERATOR0,
+    PWM1Generator1 =        TM4C_IRQ_PWM1_GENERATOR1,
+    PWM1Generator2 =        TM4C_IRQ_PWM1_GENERATOR2,
+    PWM1Generator3 =        TM4C_IRQ_PWM1_GENERATOR3,
+    PWM1Fault =             TM4C_IRQ_PWM1_FAULT,
+};
+
+/// The signature of every interrupt handler
+using Handler = void (*)();
+
+inline void enable(Irq irq) {
+    tm4c_irq_enable(static_cast<tm4c_irq_t>(irq));
+}
+
+inline void disable(Irq irq) {
+    tm4c_irq_disable(static_cast<tm4c_irq_t>(irq));
+}
+
+inline void pend(Irq irq) {
+    tm4c_irq_pend(static_cast<tm4c_irq_t>(irq));
+}
+
+inline void set_priority(Irq irq, std::uint8_t priority) {
+    tm4c_irq_set_priority(static_cast<tm4c_irq_t>(irq), priority);
+}
+
+#if defined(TM4C_RAM_VECTORS)
+/**
+ * @brief Installs the handler in the SRAM vector table.
+ *
+ * @return Handler The previously installed handler.
+ */
+inline Handler attach(Irq irq, Handler handler) {
+    return tm4c_irq_attach(static_cast<tm4c_irq_t>(irq), handler);
+}
+
+/**
+ * @brief The handler currently installed for the interrupt.
+ */
+inline Handler handler(Irq irq) {
+    return tm4c_irq_handler(static_cast<tm4c_irq_t>(irq));
+}
+#endif
+
+} // namespace tm4c
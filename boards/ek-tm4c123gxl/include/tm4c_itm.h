@@ -0,0 +1,112 @@
+/**
+ * @file tm4c_itm.h
+ * @author Esteban Duran (@astroesteban)
+ * @brief Output through the Instrumentation Trace Macrocell, which leaves the
+ *        chip on the SWO pin of the debug connector. No UART needed.
+ *
+ * @details The ITM has 32 stimulus ports, each write to one becomes a packet
+ *          tagged with the port number. The board library uses
+ *
+ *          | port | content                                             |
+ *          | ---- | --------------------------------------------------- |
+ *          | 0    | text: stdout/stderr with TM4C_STDIO_BACKEND=ITM     |
+ *          | 1    | binary trace: TM4C_LOG records (tm4c_itm_log_sink) |
+ *          | 8-31 | counters: one 32-bit value per write                |
+ *
+ *          Each port only takes a write when the ITM FIFO has room. In
+ *          TM4C_ITM_BLOCK mode a write waits for that, in TM4C_ITM_DROP mode
+ *          it gives up on the rest of the data and counts the loss. Ports the
+ *          debugger did not enable (nothing is listening) are skipped
+ *          without waiting in both modes.
+ *
+ *          Capture the SWO stream with the debugger and split it with
+ *          utils/decode_swo.py, e.g. with OpenOCD:
+ *
+ * @code
+ * > openocd -f board/ti_ek-tm4c123gxl.cfg \
+ *       -c "tpiu config internal swo.bin uart off 80000000 2000000"
+ * $ utils/decode_swo.py --elf firmware.elf swo.bin
+ * @endcode
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @ref ARMv7-M Architecture Reference Manual, appendix D4 (Debug ITM and DWT
+ *      Packet Protocol)
+ *
+ * @copyright Apache License
+ *
+ */
+#ifndef TM4C_ITM_H
+#define TM4C_ITM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* SWO bit rate tm4c_itm_init() sets up, 0 leaves the TPIU to the debugger */
+#ifndef TM4C_ITM_SWO_BAUD
+#define TM4C_ITM_SWO_BAUD 0
+#endif
+
+#define TM4C_ITM_PORTS              32
+#define TM4C_ITM_PORT_TEXT          0
+#define TM4C_ITM_PORT_LOG           1
+#define TM4C_ITM_PORT_COUNTER(n)    (8 + (n))
+#define TM4C_ITM_COUNTERS           24
+
+/**
+ * @brief What a write does when the ITM FIFO is full.
+ */
+typedef enum {
+    TM4C_ITM_BLOCK,             // wait until the FIFO takes the data
+    TM4C_ITM_DROP,              // discard what the FIFO does not take right away
+} tm4c_itm_policy_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Unlocks and enables the ITM and all stimulus ports, and with
+ *        TM4C_ITM_SWO_BAUD set the TPIU for asynchronous SWO output. Called
+ *        by the first write, calling it again is harmless.
+ */
+void tm4c_itm_init(void);
+
+/**
+ * @brief Writes bytes to a stimulus port (0 to TM4C_ITM_PORTS - 1), four at
+ *        a time where possible.
+ *
+ * @return size_t The number of bytes written, less than size only if the
+ *         policy dropped some of them. 0 for a port that does not exist.
+ */
+size_t tm4c_itm_write(uint32_t port, const void *data, size_t size);
+
+/**
+ * @brief Publishes the value of a counter (0 to TM4C_ITM_COUNTERS - 1) on its
+ *        own port. Never waits, a busy FIFO drops the value.
+ */
+void tm4c_itm_counter(uint32_t counter, uint32_t value);
+
+/**
+ * @brief Writes TM4C_LOG records to TM4C_ITM_PORT_LOG, pass it to
+ *        tm4c_log_drain().
+ */
+size_t tm4c_itm_log_sink(const void *data, size_t size);
+
+/**
+ * @brief Selects the full FIFO policy. The default is set with the
+ *        TM4C_ITM_POLICY CMake option.
+ */
+void tm4c_itm_set_policy(tm4c_itm_policy_t policy);
+
+/**
+ * @brief Number of bytes dropped because the FIFO was full, since boot.
+ */
+uint32_t tm4c_itm_dropped(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TM4C_ITM_H
@@ -0,0 +1,81 @@
+/**
+ * @file tm4c_lock.h
+ * @author Esteban Duran (@astroesteban)
+ * @brief The locks newlib takes around malloc, stdio, atexit, the
+ *        environment and the time zone, implemented as BASEPRI critical
+ *        sections.
+ *
+ * @details newlib calls the retargetable lock API (__retarget_lock_*) and
+ *          __malloc_lock()/__malloc_unlock() wherever it touches shared
+ *          state. Taking any of these locks raises BASEPRI to
+ *          TM4C_LIBC_LOCK_PRIORITY, which holds off every interrupt with that
+ *          priority or a lower one (a numerically greater or equal value)
+ *          until the lock is released. An ISR in that range can therefore
+ *          printf or malloc while the main loop is in the middle of either,
+ *          it simply runs after the main loop left the library.
+ *
+ *          Interrupts with a higher priority (0 to TM4C_LIBC_LOCK_PRIORITY - 1)
+ *          are never delayed and must never call into the C library. The
+ *          UART0 interrupt has to stay up there (it has priority 0 unless
+ *          changed), a blocking printf waits for it with the lock held.
+ *
+ *          Needs a newlib built with --enable-newlib-retargetable-locking,
+ *          as the Arm GNU Toolchain's is.
+ *
+ *          With TM4C_LIBC_LOCK_DEBUG every lock counts how often it was taken,
+ *          how often a context found it held by another one (which means an
+ *          interrupt above the lock priority used the C library) and the
+ *          longest time in cycles it was held. tm4c_lock_stats() sums them up.
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @ref https://sourceware.org/newlib/libc.html#Retargetable-Locking-Protocols
+ *
+ * @copyright Apache License
+ *
+ */
+#ifndef TM4C_LOCK_H
+#define TM4C_LOCK_H
+
+#include <stdint.h>
+
+#include "tm4c_interrupts.h"
+
+/* Interrupt priority (1 to 7) and below that the C library locks hold off */
+#ifndef TM4C_LIBC_LOCK_PRIORITY
+#define TM4C_LIBC_LOCK_PRIORITY 1
+#endif
+
+/* Locks newlib can create at runtime (one per FILE) before they are shared */
+#ifndef TM4C_LIBC_LOCKS
+#define TM4C_LIBC_LOCKS 8
+#endif
+
+#define TM4C_LIBC_LOCK_BASEPRI \
+    ((uint32_t)TM4C_LIBC_LOCK_PRIORITY << (8 - TM4C_PRIORITY_BITS))
+
+/**
+ * @brief What TM4C_LIBC_LOCK_DEBUG measured, summed over all locks.
+ */
+typedef struct {
+    uint32_t acquisitions;          // outermost acquisitions
+    uint32_t contentions;           // acquisitions while another context held the lock
+    uint32_t max_hold_cycles;       // longest time a lock was held
+} tm4c_lock_stats_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Sums up the statistics of all locks. All zero without
+ *        TM4C_LIBC_LOCK_DEBUG.
+ */
+tm4c_lock_stats_t tm4c_lock_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TM4C_LOCK_H
@@ -0,0 +1,162 @@
+/**
+ * @file tm4c_log.h
+ * @author Esteban Duran (@astroesteban)
+ * @brief Deferred binary logging. Format strings stay on the host, the
+ *        target only records which string was logged and the raw arguments.
+ *
+ * @details TM4C_LOG("adc %u: %d mV", channel, value) places the format string
+ *          in the .tm4c_log section, which the linker script keeps in the
+ *          ELF but never loads into flash. The offset of the string in that
+ *          section is its ID. A call copies a record into tm4c_log, a ring
+ *          of words in .persistent SRAM:
+ *
+ *          | word | content                                              |
+ *          | ---- | ---------------------------------------------------- |
+ *          | 0    | 0xA5 (31:24), argument count (23:20), string ID (19:0) |
+ *          | 1    | DWT cycle counter                                    |
+ *          | 2... | one word per argument                                |
+ *
+ *          Every argument is stored as one word: integers and pointers up to
+ *          32 bits as they are, float and double as a float. %s arguments
+ *          are recorded as the pointer, so they have to point at constant
+ *          strings the host can read from the ELF. At most 8 arguments.
+ *
+ *          The ring is drained into any byte sink, e.g.
+ *          `tm4c_log_drain(tm4c_uart0_write)`, or dumped from SRAM after a
+ *          crash (it survives warm resets). utils/decode_log.py turns both
+ *          back into text:
+ *
+ * @code
+ * (gdb) dump binary value log.bin tm4c_log
+ * $ utils/decode_log.py firmware.elf log.bin
+ * $ utils/decode_log.py --stream firmware.elf uart_capture.bin
+ * @endcode
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#ifndef TM4C_LOG_H
+#define TM4C_LOG_H
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Size of the ring in bytes, must be a power of two */
+#ifndef TM4C_LOG_BUFFER
+#define TM4C_LOG_BUFFER 1024
+#endif
+
+#define TM4C_LOG_WORDS      (TM4C_LOG_BUFFER / 4)
+#define TM4C_LOG_MAX_ARGS   8
+#define TM4C_LOG_MARKER     0xA5UL
+
+/**
+ * @brief The ring. Named so that utils/decode_log.py can find it.
+ */
+typedef struct {
+    volatile uint32_t head;             // words written, runs freely
+    volatile uint32_t tail;             // words drained, runs freely
+    volatile uint32_t dropped;          // records that did not fit
+    uint32_t buffer[TM4C_LOG_WORDS];
+} tm4c_log_t;
+
+/**
+ * @brief Takes the bytes of drained records, e.g. tm4c_uart0_write.
+ */
+typedef size_t (*tm4c_log_sink_t)(const void *data, size_t size);
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern tm4c_log_t tm4c_log;
+
+/**
+ * @brief Appends a record, called by TM4C_LOG. Safe from any context, a
+ *        record is dropped (and counted) when the ring is full.
+ */
+void tm4c_log_write(uint32_t id, const uint32_t *args, uint32_t count);
+
+/**
+ * @brief Hands every record written so far to the sink. Call it from one
+ *        place only (usually the main loop).
+ *
+ * @return size_t The number of bytes drained.
+ */
+size_t tm4c_log_drain(tm4c_log_sink_t sink);
+
+#ifdef __cplusplus
+}
+#endif
+
+// +--------------------------------------------------------------------------+
+// +                          Argument Encoding                               +
+// +--------------------------------------------------------------------------+
+
+#ifdef __cplusplus
+#include <bit>
+#include <type_traits>
+
+template <typename T>
+constexpr uint32_t tm4c_log_word(T value) {
+    if constexpr (std::is_floating_point_v<T>) {
+        return std::bit_cast<uint32_t>(static_cast<float>(value));
+    } else if constexpr (std::is_pointer_v<T> || std::is_null_pointer_v<T>) {
+        return static_cast<uint32_t>(reinterpret_cast<uintptr_t>(value));
+    } else {
+        static_assert(sizeof(T) <= 4, "TM4C_LOG arguments are at most 32 bits wide");
+        return static_cast<uint32_t>(value);
+    }
+}
+
+#define TM4C_LOG_WORD(x) tm4c_log_word(x)
+#else
+static inline uint32_t tm4c_log_float(float value) {
+    union { float f; uint32_t u; } bits = { value };
+    return bits.u;
+}
+
+/* The inner selections keep every branch valid for every argument type */
+#define TM4C_LOG_WORD(x)                                                      \
+    _Generic((x),                                                             \
+        float: tm4c_log_float(_Generic((x), float: (x), default: 0.0f)),      \
+        double: tm4c_log_float((float)_Generic((x), double: (x), default: 0.0)), \
+        default: (uint32_t)(uintptr_t)_Generic((x), float: 0, double: 0, default: (x)))
+#endif
+
+#define TM4C_LOG_COUNT(...) \
+    TM4C_LOG_COUNT_(__VA_ARGS__ __VA_OPT__(,) 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define TM4C_LOG_COUNT_(a1, a2, a3, a4, a5, a6, a7, a8, n, ...) n
+
+#define TM4C_LOG_MAP_1(x) TM4C_LOG_WORD(x)
+#define TM4C_LOG_MAP_2(x, ...) TM4C_LOG_WORD(x), TM4C_LOG_MAP_1(__VA_ARGS__)
+#define TM4C_LOG_MAP_3(x, ...) TM4C_LOG_WORD(x), TM4C_LOG_MAP_2(__VA_ARGS__)
+#define TM4C_LOG_MAP_4(x, ...) TM4C_LOG_WORD(x), TM4C_LOG_MAP_3(__VA_ARGS__)
+#define TM4C_LOG_MAP_5(x, ...) TM4C_LOG_WORD(x), TM4C_LOG_MAP_4(__VA_ARGS__)
+#define TM4C_LOG_MAP_6(x, ...) TM4C_LOG_WORD(x), TM4C_LOG_MAP_5(__VA_ARGS__)
+#define TM4C_LOG_MAP_7(x, ...) TM4C_LOG_WORD(x), TM4C_LOG_MAP_6(__VA_ARGS__)
+#define TM4C_LOG_MAP_8(x, ...) TM4C_LOG_WORD(x), TM4C_LOG_MAP_7(__VA_ARGS__)
+#define TM4C_LOG_MAP_(n, ...) TM4C_LOG_MAP_##n(__VA_ARGS__)
+#define TM4C_LOG_MAP(n, ...) TM4C_LOG_MAP_(n, __VA_ARGS__)
+
+/**
+ * @brief Logs a printf style message. Costs a few tens of cycles and no
+ *        flash for the format string.
+ */
+#define TM4C_LOG(format, ...)                                                 \
+    do {                                                                      \
+        __attribute__((section(".tm4c_log"), used))                           \
+        static const char tm4c_log_format_[] = format;                        \
+        const uint32_t tm4c_log_args_[] = {                                   \
+            0 __VA_OPT__(, TM4C_LOG_MAP(TM4C_LOG_COUNT(__VA_ARGS__), __VA_ARGS__))}; \
+        static_assert(TM4C_LOG_COUNT(__VA_ARGS__) <= TM4C_LOG_MAX_ARGS,       \
+                      "TM4C_LOG takes at most 8 arguments");                  \
+        tm4c_log_write((uint32_t)(uintptr_t)tm4c_log_format_, &tm4c_log_args_[1], \
+                       TM4C_LOG_COUNT(__VA_ARGS__));                          \
+    } while (0)
+
+#endif // TM4C_LOG_H
@@ -0,0 +1,88 @@
+/**
+ * @file tm4c_persistent.h
+ * @author Esteban Duran (@astroesteban)
+ * @brief SRAM that survives warm resets (watchdog, software, fault, reset
+ *        button) and is only cleared on a cold boot.
+ *
+ * @details Variables marked TM4C_PERSISTENT are placed in a region that
+ *          Reset_Handler never copies or zeroes. The region starts with a
+ *          header holding a magic number, the region size, the warm boot
+ *          count and a CRC over the three. After a power-on or brown-out
+ *          reset, or whenever the header does not check out (SRAM content is
+ *          random after power up, or the firmware layout changed), the region
+ *          is zeroed and the boot is reported as cold. Otherwise the variables keep their values.
+ *
+ * @code
+ * TM4C_PERSISTENT static uint32_t watchdog_resets;
+ *
+ * if (tm4c_persistent_boot() == TM4C_BOOT_WARM &&
+ *     (tm4c_reset_cause() & TM4C_RESET_WDT0)) {
+ *     watchdog_resets++;
+ * }
+ * @endcode
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#ifndef TM4C_PERSISTENT_H
+#define TM4C_PERSISTENT_H
+
+#include <stdint.h>
+
+#include "tm4c_sections.h"
+
+/* Reset causes as reported by SYSCTL_RESC */
+#define TM4C_RESET_EXTERNAL   (1UL << 0)    // reset pin
+#define TM4C_RESET_POWER_ON   (1UL << 1)
+#define TM4C_RESET_BROWN_OUT  (1UL << 2)
+#define TM4C_RESET_WDT0       (1UL << 3)    // watchdog timer 0
+#define TM4C_RESET_SOFTWARE   (1UL << 4)    // SYSRESETREQ, e.g. after a fault
+#define TM4C_RESET_WDT1       (1UL << 5)    // watchdog timer 1
+#define TM4C_RESET_MOSC_FAIL  (1UL << 16)   // main oscillator failure
+
+typedef enum {
+    TM4C_BOOT_COLD,     // the persistent region was zeroed
+    TM4C_BOOT_WARM,     // the persistent region kept its content
+} tm4c_boot_kind_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Checks the header of the persistent region and zeroes it if the
+ *        boot is cold. Called by Reset_Handler, do not call it yourself.
+ */
+void tm4c_persistent_init(void);
+
+/**
+ * @brief Whether the persistent variables survived the last reset.
+ */
+tm4c_boot_kind_t tm4c_persistent_boot(void);
+
+/**
+ * @brief The SYSCTL_RESC reset causes (TM4C_RESET_*) of the last reset.
+ *        Reset_Handler clears the register, so every reset reports only
+ *        what happened since the previous boot.
+ */
+uint32_t tm4c_reset_cause(void);
+
+/**
+ * @brief Number of warm boots since the last cold boot.
+ */
+uint32_t tm4c_persistent_warm_boots(void);
+
+/**
+ * @brief Invalidates the header so that the next reset is treated as a cold
+ *        boot and the persistent variables are cleared.
+ */
+void tm4c_persistent_invalidate(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TM4C_PERSISTENT_H
@@ -0,0 +1,223 @@
+/**
+ * @file tm4c_register.hpp
+ * @author Esteban Duran (@astroesteban)
+ * @brief Typed memory-mapped registers and bit fields that compile down to the
+ *        same loads and stores as the lm4f120h5qr.h macros.
+ *
+ * @details A tm4c::Register is a type, not an object: its address and access
+ *          are template arguments, so every access is a volatile load or store
+ *          at a constant address. A tm4c::Field names bits of a register,
+ *          calling it with a value gives a FieldSet (mask and value), and
+ *          FieldSets combine with |. Everything passed to modify() or write()
+ *          is merged before the register is touched, so several fields cost
+ *          one load and one store instead of one read-modify-write each:
+ *
+ * @code
+ * using RCC = tm4c::Register<0x400FE060>;
+ * constexpr tm4c::Field<23, 4> SYSDIV;
+ * constexpr tm4c::Field<22, 1, bool> USESYSDIV;
+ * constexpr tm4c::Field<6, 5> XTAL;
+ * constexpr tm4c::Field<4, 2, Oscillator> OSCSRC;
+ *
+ * RCC::modify(XTAL(0x15) | OSCSRC(Oscillator::Main) | USESYSDIV(true) | SYSDIV(4));
+ * RCC::modify<XTAL(0x15), OSCSRC(Oscillator::Main)>();   // merged at compile time
+ * const auto divisor = RCC::get(SYSDIV);
+ * @endcode
+ *
+ *          A FieldSet that covers the whole register is stored without the
+ *          load. Values that do not fit their field and fields that overlap
+ *          are compile errors wherever the FieldSet is a constant expression.
+ *          Reading a write-only register or writing a read-only one does not
+ *          compile.
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#pragma once
+
+// Only <cstdint>: every file touching a register includes this, and
+// <type_traits> alone would triple the time to compile a small one
+#include <cstdint>
+
+#ifdef TM4C_REGISTER_SIMULATED
+// Host tests implement every register access
+extern "C" std::uint32_t tm4c_register_sim_read(std::uint32_t address);
+extern "C" void tm4c_register_sim_write(std::uint32_t address, std::uint32_t value);
+#endif
+
+namespace tm4c {
+
+enum class Access { ReadWrite, ReadOnly, WriteOnly };
+
+namespace detail {
+
+// Not constexpr, so calling them during constant evaluation is a compile error
+inline void field_value_out_of_range() {}
+inline void fields_overlap() {}
+
+template <typename T>
+constexpr bool is_field_type() {
+    if constexpr (__is_enum(T)) {
+        return true;
+    } else {
+        return T(-1) > T(0);            // unsigned integers and bool
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief Bits to change in a register and the values to change them to.
+ */
+struct FieldSet {
+    std::uint32_t mask;
+    std::uint32_t value;
+
+    friend constexpr FieldSet operator|(FieldSet a, FieldSet b) noexcept {
+        if consteval {
+            if ((a.mask & b.mask) != 0) {
+                detail::fields_overlap();
+            }
+        }
+        return {a.mask | b.mask, a.value | b.value};
+    }
+
+    friend constexpr bool operator==(FieldSet, FieldSet) = default;
+};
+
+/**
+ * @brief Width bits of a register starting at bit Offset, holding a T (an
+ *        unsigned integer, bool or an enum of the field's encodings).
+ */
+template <unsigned Offset, unsigned Width, typename T = std::uint32_t>
+struct Field {
+    static_assert(Width > 0 && Offset + Width <= 32, "The field does not fit into a 32-bit register");
+    static_assert(detail::is_field_type<T>(), "Fields hold unsigned integers, bools or enums");
+
+    using value_type = T;
+    static constexpr unsigned offset = Offset;
+    static constexpr unsigned width = Width;
+    static constexpr std::uint32_t max = Width == 32 ? 0xFFFFFFFFU : (1U << Width) - 1U;
+    static constexpr std::uint32_t mask = max << Offset;
+
+    /// All bits of the field set and cleared
+    static constexpr FieldSet ones{mask, mask};
+    static constexpr FieldSet zeros{mask, 0};
+
+    constexpr FieldSet operator()(T value) const noexcept {
+        const auto raw = static_cast<std::uint32_t>(value);
+        if consteval {
+            if (raw > max) {
+                detail::field_value_out_of_range();
+            }
+        }
+        return {mask, (raw << Offset) & mask};
+    }
+
+    /// The field's value in a register value
+    static constexpr T extract(std::uint32_t reg) noexcept {
+        return static_cast<T>((reg & mask) >> Offset);
+    }
+};
+
+/**
+ * @brief The 32-bit register at Address.
+ */
+template <std::uint32_t Address, Access A = Access::ReadWrite>
+struct Register {
+    static_assert(Address % 4 == 0, "Registers are word aligned");
+
+    static constexpr std::uint32_t address = Address;
+    static constexpr Access access = A;
+
+    [[gnu::always_inline]] static std::uint32_t read() noexcept
+        requires(A != Access::WriteOnly)
+    {
+        return load();
+    }
+
+    template <typename F>
+    [[gnu::always_inline]] static typename F::value_type get(F = {}) noexcept
+        requires(A != Access::WriteOnly)
+    {
+        return F::extract(load());
+    }
+
+    [[gnu::always_inline]] static void write(std::uint32_t value) noexcept
+        requires(A != Access::ReadOnly)
+    {
+        store(value);
+    }
+
+    /**
+     * @brief Stores the fields in one go, bits outside of them are written as
+     *        zero.
+     */
+    [[gnu::always_inline]] static void write(FieldSet fields) noexcept
+        requires(A != Access::ReadOnly)
+    {
+        store(fields.value);
+    }
+
+    /**
+     * @brief Changes the fields with one load and one store, bits outside of
+     *        them keep their values. Not atomic, an interrupt that changes
+     *        the same register in between is overwritten.
+     */
+    [[gnu::always_inline]] static void modify(FieldSet fields) noexcept
+        requires(A == Access::ReadWrite)
+    {
+        if (fields.mask == 0xFFFFFFFFU) {
+            store(fields.value);
+        } else {
+            store((load() & ~fields.mask) | fields.value);
+        }
+    }
+
+    /**
+     * @brief modify() with the fields merged and checked at compile time.
+     */
+    template <FieldSet First, FieldSet... Rest>
+    [[gnu::always_inline]] static void modify() noexcept
+        requires(A == Access::ReadWrite)
+    {
+        constexpr FieldSet fields = (First | ... | Rest);
+        modify(fields);
+    }
+
+    /// Sets the bits in mask, the |= of the macros
+    [[gnu::always_inline]] static void set(std::uint32_t mask) noexcept
+        requires(A == Access::ReadWrite)
+    {
+        store(load() | mask);
+    }
+
+    /// Clears the bits in mask
+    [[gnu::always_inline]] static void clear(std::uint32_t mask) noexcept
+        requires(A == Access::ReadWrite)
+    {
+        store(load() & ~mask);
+    }
+
+private:
+    [[gnu::always_inline]] static std::uint32_t load() noexcept {
+#ifdef TM4C_REGISTER_SIMULATED
+        return tm4c_register_sim_read(Address);
+#else
+        return *reinterpret_cast<volatile std::uint32_t *>(Address);
+#endif
+    }
+
+    [[gnu::always_inline]] static void store(std::uint32_t value) noexcept {
+#ifdef TM4C_REGISTER_SIMULATED
+        tm4c_register_sim_write(Address, value);
+#else
+        *reinterpret_cast<volatile std::uint32_t *>(Address) = value;
+#endif
+    }
+};
+
+} // namespace tm4c
@@ -0,0 +1,180 @@
+/**
+ * @file tm4c_ring.h
+ * @author Esteban Duran (@astroesteban)
+ * @brief A lock-free single producer, single consumer byte ring. Used to hand
+ *        bytes between the main loop and an interrupt handler.
+ *
+ * @details The indices run freely and are only masked when the buffer is
+ *          accessed, so the ring holds all `size` bytes and `head - tail` is
+ *          the fill level even after the indices wrap. Only the producer
+ *          writes `head` and only the consumer writes `tail`. Both are single
+ *          aligned word stores, which the core never tears, so no critical
+ *          section is needed as long as there is one producer and one
+ *          consumer. The compiler fences keep the data accesses on the right
+ *          side of the index updates; the Cortex-M4 is single core and does
+ *          not reorder its own accesses to normal memory.
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#ifndef TM4C_RING_H
+#define TM4C_RING_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * @brief Whether x is a power of two. Ring sizes have to be one.
+ */
+#define TM4C_IS_POWER_OF_TWO(x) ((x) != 0 && ((x) & ((x) - 1)) == 0)
+
+/**
+ * @brief Initializer of a ring over a static array, e.g.
+ *        `static tm4c_ring_t ring = TM4C_RING_INIT(storage);`
+ */
+#define TM4C_RING_INIT(storage) { (storage), sizeof(storage) - 1, 0, 0 }
+
+typedef struct {
+    uint8_t *buffer;
+    uint32_t mask;              // size - 1
+    volatile uint32_t head;     // next byte to write, owned by the producer
+    volatile uint32_t tail;     // next byte to read, owned by the consumer
+} tm4c_ring_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+static inline uint32_t tm4c_ring_size(const tm4c_ring_t *ring) {
+    return ring->mask + 1;
+}
+
+/**
+ * @brief Number of bytes waiting to be read.
+ */
+static inline uint32_t tm4c_ring_used(const tm4c_ring_t *ring) {
+    return ring->head - ring->tail;
+}
+
+/**
+ * @brief Number of bytes that can be written without overwriting anything.
+ */
+static inline uint32_t tm4c_ring_free(const tm4c_ring_t *ring) {
+    return tm4c_ring_size(ring) - tm4c_ring_used(ring);
+}
+
+/**
+ * @brief Producer side. Copies as many bytes as fit into the ring.
+ *
+ * @return uint32_t The number of bytes written.
+ */
+static inline uint32_t tm4c_ring_write(tm4c_ring_t *ring, const void *data, uint32_t size) {
+    const uint32_t head = ring->head;
+    const uint32_t free = tm4c_ring_size(ring) - (head - ring->tail);
+    const uint32_t count = size < free ? size : free;
+    const uint32_t start = head & ring->mask;
+    const uint32_t first = count < tm4c_ring_size(ring) - start ? count : tm4c_ring_size(ring) - start;
+
+    memcpy(&ring->buffer[start], data, first);
+    memcpy(ring->buffer, (const uint8_t *)data + first, count - first);
+
+    // publish the bytes only once they are in the buffer
+    __atomic_signal_fence(__ATOMIC_RELEASE);
+    ring->head = head + count;
+    return count;
+}
+
+/**
+ * @brief Producer side. Writes a single byte.
+ *
+ * @return int 1 if the byte was written, 0 if the ring is full.
+ */
+static inline int tm4c_ring_put(tm4c_ring_t *ring, uint8_t byte) {
+    const uint32_t head = ring->head;
+
+    if (head - ring->tail == tm4c_ring_size(ring)) {
+        return 0;
+    }
+
+    ring->buffer[head & ring->mask] = byte;
+    __atomic_signal_fence(__ATOMIC_RELEASE);
+    ring->head = head + 1;
+    return 1;
+}
+
+/**
+ * @brief Consumer side. Takes the oldest byte out of the ring.
+ *
+ * @return int 1 if a byte was read, 0 if the ring is empty.
+ */
+static inline int tm4c_ring_get(tm4c_ring_t *ring, uint8_t *byte) {
+    const uint32_t tail = ring->tail;
+
+    if (ring->head == tail) {
+        return 0;
+    }
+
+    __atomic_signal_fence(__ATOMIC_ACQUIRE);
+    *byte = ring->buffer[tail & ring->mask];
+    __atomic_signal_fence(__ATOMIC_RELEASE);
+    ring->tail = tail + 1;
+    return 1;
+}
+
+/**
+ * @brief Consumer side. Copies up to size bytes out of the ring.
+ *
+ * @return uint32_t The number of bytes read.
+ */
+static inline uint32_t tm4c_ring_read(tm4c_ring_t *ring, void *data, uint32_t size) {
+    const uint32_t tail = ring->tail;
+    const uint32_t used = ring->head - tail;
+    const uint32_t count = size < used ? size : used;
+    const uint32_t start = tail & ring->mask;
+    const uint32_t first = count < tm4c_ring_size(ring) - start ? count : tm4c_ring_size(ring) - start;
+
+    __atomic_signal_fence(__ATOMIC_ACQUIRE);
+    memcpy(data, &ring->buffer[start], first);
+    memcpy((uint8_t *)data + first, ring->buffer, count - first);
+
+    // hand the space back only once the bytes are copied out
+    __atomic_signal_fence(__ATOMIC_RELEASE);
+    ring->tail = tail + count;
+    return count;
+}
+
+/**
+ * @brief Consumer side. The oldest bytes that are contiguous in memory, e.g.
+ *        to hand them to a DMA channel. Release them with tm4c_ring_skip().
+ *
+ * @return uint32_t The number of contiguous bytes at *span.
+ */
+static inline uint32_t tm4c_ring_span(const tm4c_ring_t *ring, const uint8_t **span) {
+    const uint32_t tail = ring->tail;
+    const uint32_t used = ring->head - tail;
+    const uint32_t start = tail & ring->mask;
+    const uint32_t contiguous = tm4c_ring_size(ring) - start;
+
+    __atomic_signal_fence(__ATOMIC_ACQUIRE);
+    *span = &ring->buffer[start];
+    return used < contiguous ? used : contiguous;
+}
+
+/**
+ * @brief Consumer side. Drops the oldest count bytes, count must not be larger
+ *        than tm4c_ring_used().
+ */
+static inline void tm4c_ring_skip(tm4c_ring_t *ring, uint32_t count) {
+    __atomic_signal_fence(__ATOMIC_RELEASE);
+    ring->tail = ring->tail + count;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TM4C_RING_H
@@ -0,0 +1,77 @@
+/**
+ * @file tm4c_sections.h
+ * @author Esteban Duran (@astroesteban)
+ * @brief Attributes that place code and data into the special sections of
+ *        tm4c123gh6pm.ld.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#ifndef TM4C_SECTIONS_H
+#define TM4C_SECTIONS_H
+
+#define TM4C_STRINGIFY_(x) #x
+#define TM4C_STRINGIFY(x) TM4C_STRINGIFY_(x)
+
+/*
+ * Builds a unique input section name so that -Wl,--gc-sections can still
+ * discard every function or variable on its own.
+*/
+#define TM4C_SECTION(prefix) \
+    __attribute__((section(prefix "." TM4C_STRINGIFY(__COUNTER__))))
+
+/**
+ * @brief Runs the function from SRAM. The code is stored in FLASH and copied
+ *        into SRAM by Reset_Handler.
+ *
+ * @details SRAM is far outside the range of a BL instruction from FLASH, so
+ *          the function is marked long_call and never inlined into a FLASH
+ *          resident caller. Callers in other translation units that do not
+ *          see the attribute are reached through a linker generated veneer.
+ *          Put it on the definition only, every use picks a new section name.
+ *
+ * @code
+ * TM4C_RAMFUNC void Timer0A_ISR(void) { ... }
+ * @endcode
+ */
+#define TM4C_RAMFUNC TM4C_SECTION(".ramfunc") __attribute__((noinline, long_call))
+
+/*
+ * TM4C_HOT and TM4C_COLD expand to nothing when TM4C_DISABLE_CODE_GROUPING is
+ * defined, which lets benchmarks compare both layouts from the same source.
+*/
+#if defined(TM4C_DISABLE_CODE_GROUPING)
+#define TM4C_HOT
+#define TM4C_COLD
+#else
+/**
+ * @brief Places the function in the hot block at the start of FLASH, next to
+ *        the other hot functions and aligned to a flash prefetch line. Use it
+ *        for ISRs and inner loops, including a main() holding the super loop
+ *        (GCC puts main() with the cold startup code otherwise).
+ */
+#define TM4C_HOT TM4C_SECTION(".text.hot") __attribute__((hot))
+
+/**
+ * @brief Moves the function out of the way of the hot and regular code and
+ *        tells GCC that calls to it are unlikely (error paths, init code).
+ */
+#define TM4C_COLD TM4C_SECTION(".text.unlikely") __attribute__((cold))
+#endif
+
+/**
+ * @brief Leaves the variable uninitialized. Reset_Handler neither copies nor
+ *        zeroes it, which saves the boot time of clearing large buffers that
+ *        are overwritten anyway. Do not give it an initializer.
+ */
+#define TM4C_NOINIT TM4C_SECTION(".noinit")
+
+/**
+ * @brief Keeps the variable across warm resets, see tm4c_persistent.h. It is
+ *        zeroed on a cold boot. Do not give it an initializer.
+ */
+#define TM4C_PERSISTENT TM4C_SECTION(".persistent")
+
+#endif // TM4C_SECTIONS_H
@@ -0,0 +1,95 @@
+/**
+ * @file tm4c_time.h
+ * @author Esteban Duran (@astroesteban)
+ * @brief 64-bit monotonic time base counting core clock cycles since boot.
+ *
+ * @details Wide timer 5 runs as one 64-bit up counter on the system clock,
+ *          started by Reset_Handler right after the clock is configured. At
+ *          80 MHz it wraps after more than 7000 years, so there is no
+ *          overflow interrupt and no state in SRAM. Reads take the upper
+ *          half, the lower half and the upper half again and retry if the
+ *          lower half wrapped in between: lock-free, safe from any interrupt
+ *          and never torn.
+ *
+ *          The time base backs `_times` (clock()), `_gettimeofday`
+ *          (gettimeofday(), std::chrono::system_clock) and clock_gettime().
+ *          libstdc++ built for newlib has no CLOCK_MONOTONIC
+ *          (_GLIBCXX_USE_CLOCK_MONOTONIC is not defined), so its
+ *          std::chrono::steady_clock is system_clock under another name and
+ *          jumps with tm4c_time_set_realtime(). The steady clock is
+ *          tm4c::Clock of tm4c_time.hpp, with cycle resolution.
+ *
+ *          There is no battery backed clock, CLOCK_REALTIME starts at the
+ *          epoch on every boot until tm4c_time_set_realtime() is called.
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @ref TM4C123GH6PM datasheet section 11.3.2.1 (One-Shot/Periodic Timer Mode)
+ *
+ * @copyright Apache License
+ *
+ */
+#ifndef TM4C_TIME_H
+#define TM4C_TIME_H
+
+#include <stdint.h>
+#include <sys/types.h>
+#include <time.h>
+
+#include "tm4c_clock.h"
+
+/* The clocks clock_gettime() knows, with newlib's numbering */
+#ifndef CLOCK_REALTIME
+#define CLOCK_REALTIME ((clockid_t)1)
+#endif
+#ifndef CLOCK_MONOTONIC
+#define CLOCK_MONOTONIC ((clockid_t)4)
+#endif
+
+#define TM4C_TIME_HZ TM4C_SYSCLK_HZ
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Powers up and starts the counter. Called by Reset_Handler, calling
+ *        it again is harmless.
+ */
+void tm4c_time_init(void);
+
+/**
+ * @brief Core clock cycles (TM4C_TIME_HZ) since the time base started.
+ */
+uint64_t tm4c_time_ticks(void);
+
+/**
+ * @brief Nanoseconds since the time base started.
+ */
+uint64_t tm4c_time_ns(void);
+
+/**
+ * @brief Sets the wall clock CLOCK_REALTIME and gettimeofday() report from
+ *        now on, e.g. with a time received over the network.
+ */
+void tm4c_time_set_realtime(const struct timespec *now);
+
+/**
+ * @brief Reads CLOCK_MONOTONIC (time since boot) or CLOCK_REALTIME, backs
+ *        clock_gettime().
+ *
+ * @return int 0 on success, -1 for other clocks.
+ */
+int tm4c_time_get(clockid_t clock_id, struct timespec *tp);
+
+#if !defined(TM4C_TIME_SIMULATED)
+/* newlib leaves clock_gettime() to the system, syscalls.c provides it */
+int clock_gettime(clockid_t clock_id, struct timespec *tp);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TM4C_TIME_H
@@ -0,0 +1,69 @@
+/**
+ * @file tm4c_time.hpp
+ * @author Esteban Duran (@astroesteban)
+ * @brief std::chrono view of the time base in tm4c_time.h.
+ *
+ * @details tm4c::Clock ticks once per core clock cycle, so latency
+ *          measurements keep cycle resolution and still convert to any other
+ *          duration:
+ *
+ * @code
+ * const auto start = tm4c::Clock::now();
+ * work();
+ * const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+ *     tm4c::Clock::now() - start);
+ * @endcode
+ *
+ *          Use it instead of std::chrono::steady_clock, which only counts
+ *          from CLOCK_MONOTONIC when libstdc++ was built with it.
+ *          tm4c::steady_clock_is_monotonic tells which one the toolchain has.
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <ratio>
+
+#include "tm4c_time.h"
+
+namespace tm4c {
+
+/**
+ * @brief Steady clock counting core clock cycles since boot. Reading it is
+ *        lock-free and safe from interrupts.
+ */
+struct Clock {
+    using rep = std::int64_t;
+    using period = std::ratio<1, TM4C_TIME_HZ>;
+    using duration = std::chrono::duration<rep, period>;
+    using time_point = std::chrono::time_point<Clock>;
+
+    static constexpr bool is_steady = true;
+
+    static time_point now() noexcept {
+        return time_point{duration{static_cast<rep>(tm4c_time_ticks())}};
+    }
+};
+
+/**
+ * @brief Whether std::chrono::steady_clock reads CLOCK_MONOTONIC. Without it
+ *        libstdc++ falls back to system_clock, which moves backwards when
+ *        tm4c_time_set_realtime() sets an earlier time. The newlib toolchain
+ *        of this board builds libstdc++ without it.
+ */
+#if defined(_GLIBCXX_USE_CLOCK_MONOTONIC)
+inline constexpr bool steady_clock_is_monotonic = true;
+#else
+inline constexpr bool steady_clock_is_monotonic = false;
+#endif
+
+/// A number of core clock cycles as a duration
+using Cycles = Clock::duration;
+
+} // namespace tm4c
@@ -0,0 +1,181 @@
+/**
+ * @file tm4c_uart.h
+ * @author Esteban Duran (@astroesteban)
+ * @brief Interrupt-driven UART0 (the virtual COM port of the ICDI) behind
+ *        stdin, stdout and stderr.
+ *
+ * @details Writes are copied into a TX ring (tm4c_ring.h) and return right
+ *          away, the UART0 interrupt refills the hardware FIFO from the ring
+ *          whenever it drains to half full. The driver initializes itself on
+ *          the first write, 8N1 at TM4C_STDIO_BAUD.
+ *
+ *          With TM4C_STDIO_DMA_THRESHOLD set, whenever at least that many
+ *          bytes are queued the uDMA streams them from the ring into the
+ *          FIFO instead, which costs one interrupt per transfer (up to 1 KB)
+ *          instead of one every 8 bytes. tm4c_uart0_write_async() streams a
+ *          caller's buffer without copying it at all.
+ *
+ *          Received bytes are collected into an RX ring by the interrupt,
+ *          which fires when the RX FIFO is half full or has been idle for
+ *          32 bit periods. In cooked mode (the default) readers get whole
+ *          lines that were edited with backspace and echoed like a
+ *          terminal does, raw mode hands out the bytes as they arrived.
+ *          tm4c_uart0_available() and tm4c_uart0_read_some() never block,
+ *          `_read` (stdin) blocks until there is something to return.
+ *
+ *          The TX ring has a single producer: write from the main loop, or make
+ *          sure writers from different interrupt priorities never overlap.
+ *          printf and friends do the latter through the stdio locks of
+ *          tm4c_lock.h.
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#ifndef TM4C_UART_H
+#define TM4C_UART_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef TM4C_STDIO_BAUD
+#define TM4C_STDIO_BAUD 115200UL
+#endif
+
+/* Size of the TX ring in bytes, must be a power of two */
+#ifndef TM4C_STDIO_TX_BUFFER
+#define TM4C_STDIO_TX_BUFFER 512
+#endif
+
+/* Size of the RX ring in bytes, must be a power of two */
+#ifndef TM4C_STDIO_RX_BUFFER
+#define TM4C_STDIO_RX_BUFFER 256
+#endif
+
+/* Longest line cooked mode collects, the newline included */
+#ifndef TM4C_STDIO_LINE_MAX
+#define TM4C_STDIO_LINE_MAX 128
+#endif
+
+/* Queued bytes that make the transmitter use the uDMA, 0 never uses it */
+#ifndef TM4C_STDIO_DMA_THRESHOLD
+#define TM4C_STDIO_DMA_THRESHOLD 0
+#endif
+
+/**
+ * @brief What a write does when the TX ring is full.
+ */
+typedef enum {
+    TM4C_UART_BLOCK,            // wait (feeding the FIFO directly) until there is space
+    TM4C_UART_DROP_NEWEST,      // discard the bytes that do not fit
+    TM4C_UART_DROP_OLDEST,      // discard the oldest queued bytes to make space
+} tm4c_uart_policy_t;
+
+/**
+ * @brief How received bytes reach the readers.
+ */
+typedef enum {
+    TM4C_UART_RAW,              // byte by byte, as they arrived (binary protocols)
+    TM4C_UART_COOKED,           // edited and echoed lines ending in '\n'
+} tm4c_uart_mode_t;
+
+/**
+ * @brief Called when the buffer of tm4c_uart0_write_async() is sent. Runs in
+ *        the UART0 interrupt (or the writer that noticed the completion).
+ */
+typedef void (*tm4c_uart_done_t)(void *context);
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Powers up UART0 and its pins (PA0/PA1) and enables its interrupt.
+ *        Called by the first write, calling it again is harmless.
+ */
+void tm4c_uart0_init(void);
+
+/**
+ * @brief Queues bytes for transmission.
+ *
+ * @return size_t The number of bytes taken. TM4C_UART_BLOCK always takes all
+ *         of them. TM4C_UART_DROP_NEWEST returns less than size when it
+ *         dropped the tail of data. TM4C_UART_DROP_OLDEST always returns size,
+ *         even though it makes room by dropping queued bytes, and also the
+ *         leading bytes of data when size exceeds the ring. Its losses only
+ *         show in tm4c_uart0_dropped().
+ */
+size_t tm4c_uart0_write(const void *data, size_t size);
+
+/**
+ * @brief Sends the buffer straight from where it is (zero-copy) after what is
+ *        already queued. The buffer has to stay untouched until done is
+ *        called. Without the uDMA (TM4C_STDIO_DMA_THRESHOLD = 0) the bytes go
+ *        through the ring and done is called before returning.
+ *
+ * @param done Called once the last byte is in the FIFO, may be NULL.
+ * @return int 0 if the buffer is queued, -1 if the previous one is still
+ *         being sent.
+ */
+int tm4c_uart0_write_async(const void *data, size_t size, tm4c_uart_done_t done,
+                           void *context);
+
+/**
+ * @brief Waits until every queued byte has left the UART.
+ */
+void tm4c_uart0_flush(void);
+
+/**
+ * @brief Selects the full ring policy. The default is set with the
+ *        TM4C_STDIO_TX_POLICY CMake option.
+ */
+void tm4c_uart0_set_policy(tm4c_uart_policy_t policy);
+
+/**
+ * @brief Number of bytes dropped because the ring was full, since boot.
+ *        Includes the echo of cooked mode, which is dropped under every
+ *        policy so that reading never waits for the transmitter.
+ */
+uint32_t tm4c_uart0_dropped(void);
+
+/**
+ * @brief Switches between raw and cooked input. An unfinished line is
+ *        discarded.
+ */
+void tm4c_uart0_set_mode(tm4c_uart_mode_t mode);
+
+/**
+ * @brief Number of bytes tm4c_uart0_read_some() can return right now, in
+ *        cooked mode only complete lines count.
+ */
+size_t tm4c_uart0_available(void);
+
+/**
+ * @brief Reads what is available without waiting.
+ *
+ * @return size_t The number of bytes read, 0 if there is nothing to read.
+ */
+size_t tm4c_uart0_read_some(void *data, size_t size);
+
+/**
+ * @brief Reads, waiting (asleep) until at least one byte, or in cooked mode
+ *        one line, is available. Backs `_read` on stdin.
+ *
+ * @return size_t The number of bytes read.
+ */
+size_t tm4c_uart0_read(void *data, size_t size);
+
+/**
+ * @brief Number of received bytes lost since boot: the RX ring was full,
+ *        the FIFO overflowed or the byte had a framing, parity or break
+ *        error.
+ */
+uint32_t tm4c_uart0_rx_lost(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TM4C_UART_H
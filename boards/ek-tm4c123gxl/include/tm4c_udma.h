@@ -0,0 +1,121 @@
+/**
+ * @file tm4c_udma.h
+ * @author Esteban Duran (@astroesteban)
+ * @brief Minimal driver of the micro DMA controller: basic mode transfers
+ *        on the primary control structures.
+ *
+ * @details The controller needs a single channel control table for the
+ *          whole chip, tm4c_udma_table. It is the full 1 KB table, the
+ *          primary structures of the 32 channels followed by the alternate
+ *          ones at offset 0x200. This driver only uses the primary ones, code
+ *          outside the board library may share the table for other channels
+ *          in any mode, ping-pong and scatter-gather included (TivaWare:
+ *          `uDMAControlBaseSet(tm4c_udma_table)`).
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @ref TM4C123GH6PM datasheet chapter 9 (Micro Direct Memory Access)
+ *
+ * @copyright Apache License
+ *
+ */
+#ifndef TM4C_UDMA_H
+#define TM4C_UDMA_H
+
+#include <stdint.h>
+
+#define TM4C_UDMA_CHANNELS          32
+#define TM4C_UDMA_TABLE_ENTRIES     (2 * TM4C_UDMA_CHANNELS)  // primary, then alternate
+#define TM4C_UDMA_MAX_TRANSFER      1024    // items per basic mode transfer
+
+/* Channel assignments used by the board library (encoding 0) */
+#define TM4C_UDMA_CH_UART0_RX       8
+#define TM4C_UDMA_CH_UART0_TX       9
+
+/* Fields of the channel control word */
+#define TM4C_UDMA_DST_INC_8         (0x0UL << 30)
+#define TM4C_UDMA_DST_INC_32        (0x2UL << 30)
+#define TM4C_UDMA_DST_INC_NONE      (0x3UL << 30)
+#define TM4C_UDMA_DST_SIZE_8        (0x0UL << 28)
+#define TM4C_UDMA_DST_SIZE_32       (0x2UL << 28)
+#define TM4C_UDMA_SRC_INC_8         (0x0UL << 26)
+#define TM4C_UDMA_SRC_INC_32        (0x2UL << 26)
+#define TM4C_UDMA_SRC_INC_NONE      (0x3UL << 26)
+#define TM4C_UDMA_SRC_SIZE_8        (0x0UL << 24)
+#define TM4C_UDMA_SRC_SIZE_32       (0x2UL << 24)
+#define TM4C_UDMA_ARB(log2_items)   ((uint32_t)(log2_items) << 14)
+#define TM4C_UDMA_XFER_SIZE(items)  (((uint32_t)(items) - 1UL) << 4)
+#define TM4C_UDMA_MODE_STOP         0x0UL
+#define TM4C_UDMA_MODE_BASIC        0x1UL
+
+/**
+ * @brief A channel control structure as the controller reads it from SRAM.
+ *        The controller updates the transfer size and mode while it runs.
+ */
+typedef struct {
+    const volatile void *source_end;        // address of the last source item
+    volatile void *destination_end;         // address of the last destination item
+    uint32_t control;                       // TM4C_UDMA_* fields
+    uint32_t spare;
+} tm4c_udma_control_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief The control structures of all channels (1 KB aligned). Entry n is
+ *        the primary and entry TM4C_UDMA_CHANNELS + n the alternate one of
+ *        channel n.
+ */
+extern volatile tm4c_udma_control_t tm4c_udma_table[TM4C_UDMA_TABLE_ENTRIES];
+
+/**
+ * @brief Powers up the controller and points it at tm4c_udma_table. Calling
+ *        it again is harmless.
+ */
+void tm4c_udma_init(void);
+
+/**
+ * @brief Assigns the peripheral (the encoding of the channel map) to the
+ *        channel.
+ */
+void tm4c_udma_assign(uint32_t channel, uint32_t encoding);
+
+/**
+ * @brief Starts a basic mode transfer on a peripheral channel. The end
+ *        pointers are derived from the start addresses and the control word.
+ *
+ * @param control The TM4C_UDMA_* fields, including the transfer size of at
+ *                most TM4C_UDMA_MAX_TRANSFER items.
+ */
+void tm4c_udma_start(uint32_t channel, const volatile void *source,
+                     volatile void *destination, uint32_t control);
+
+/**
+ * @brief Whether the channel is still transferring.
+ */
+int tm4c_udma_busy(uint32_t channel);
+
+/**
+ * @brief Checks and acknowledges the completion interrupt of the channel.
+ *        The completion of a peripheral channel raises the interrupt of the
+ *        peripheral, its handler has to call this.
+ *
+ * @return int 1 if the channel completed a transfer since the last call.
+ */
+int tm4c_udma_done(uint32_t channel);
+
+/**
+ * @brief Stops the channel.
+ *
+ * @return uint32_t The number of items it did not transfer.
+ */
+uint32_t tm4c_udma_stop(uint32_t channel);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TM4C_UDMA_H
@@ -0,0 +1,193 @@
+/**
+ * @file itm.c
+ * @author Esteban Duran (@astroesteban)
+ * @brief The ITM/SWO output described in tm4c_itm.h.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @ref ARMv7-M Architecture Reference Manual, section C1.7 (Instrumentation
+ *      Trace Macrocell) and C1.10 (Trace Port Interface Unit)
+ *
+ * @copyright Apache License
+ *
+ */
+#include "tm4c_itm.h"
+
+#include <assert.h>
+#include <string.h>
+
+#include "tm4c_clock.h"
+
+// +--------------------------------------------------------------------------+
+// +			        Type Definitions and Macros                           +
+// +--------------------------------------------------------------------------+
+
+/*
+ * The host tests (test/host) build this file against a simulated ITM. The
+ * stimulus ports take 8 and 32 bit writes, so the simulation gets the width
+ * of every access.
+ */
+#if defined(TM4C_ITM_SIMULATED)
+uint32_t tm4c_itm_sim_read(uint32_t address);
+void tm4c_itm_sim_write(uint32_t address, uint32_t value, size_t width);
+#define REG_READ(address) tm4c_itm_sim_read(address)
+#define REG_WRITE(address, value, type) tm4c_itm_sim_write(address, value, sizeof(type))
+#else
+#define REG_READ(address) (*((volatile uint32_t *)(address)))
+#define REG_WRITE(address, value, type) (*((volatile type *)(address)) = (type)(value))
+#endif
+
+#define ITM_STIM(port)      (0xE0000000UL + 4 * (port)) // Stimulus Port n
+#define ITM_TER             0xE0000E00UL    // Trace Enable
+#define ITM_TPR             0xE0000E40UL    // Trace Privilege
+#define ITM_TCR             0xE0000E80UL    // Trace Control
+#define ITM_LAR             0xE0000FB0UL    // Lock Access
+#define TPIU_CSPSR          0xE0040004UL    // Current Parallel Port Size
+#define TPIU_ACPR           0xE0040010UL    // Asynchronous Clock Prescaler
+#define TPIU_SPPR           0xE00400F0UL    // Selected Pin Protocol
+#define TPIU_FFCR           0xE0040304UL    // Formatter and Flush Control
+#define DEMCR               0xE000EDFCUL    // Debug Exception and Monitor Control
+
+#define ITM_STIM_READY      (1UL << 0)      // the FIFO takes a write
+#define ITM_TCR_ITMENA      (1UL << 0)
+#define ITM_TCR_SWOENA      (1UL << 4)      // timestamps count the SWO clock
+#define ITM_TCR_BUSID(id)   ((uint32_t)(id) << 16)
+#define ITM_LAR_KEY         0xC5ACCE55UL
+#define TPIU_SPPR_NRZ       0x2UL           // asynchronous, UART like
+#define TPIU_FFCR_TRIGIN    (1UL << 8)      // formatter off, ITM packets go out as they are
+#define DEMCR_TRCENA        (1UL << 24)
+
+#if TM4C_ITM_SWO_BAUD > 0
+static_assert(TM4C_ITM_SWO_BAUD <= TM4C_SYSCLK_HZ,
+              "The SWO bit rate is derived from the core clock and cannot exceed it");
+#endif
+
+#if defined(TM4C_ITM_POLICY_DROP)
+#define ITM_DEFAULT_POLICY TM4C_ITM_DROP
+#else
+#define ITM_DEFAULT_POLICY TM4C_ITM_BLOCK
+#endif
+
+
+// +--------------------------------------------------------------------------+
+// +					Global Variables definition	    				      +
+// +--------------------------------------------------------------------------+
+static int initialized;
+static tm4c_itm_policy_t policy = ITM_DEFAULT_POLICY;
+static volatile uint32_t dropped;
+
+
+// +--------------------------------------------------------------------------+
+// +                          Function Definitions                            +
+// +--------------------------------------------------------------------------+
+
+/**
+ * @brief Whether anything listens on the port: the ITM and the port are on.
+ */
+static int port_enabled(uint32_t port) {
+    if (port >= TM4C_ITM_PORTS) {
+        return 0;
+    }
+    return (REG_READ(ITM_TCR) & ITM_TCR_ITMENA) != 0 && (REG_READ(ITM_TER) & (1UL << port)) != 0;
+}
+
+/**
+ * @brief Waits for room in the FIFO, or checks for it once when dropping.
+ */
+static int port_ready(uint32_t port, tm4c_itm_policy_t mode) {
+    while ((REG_READ(ITM_STIM(port)) & ITM_STIM_READY) == 0) {
+        if (mode == TM4C_ITM_DROP) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+void tm4c_itm_init(void) {
+    if (initialized) {
+        return;
+    }
+
+    REG_WRITE(DEMCR, REG_READ(DEMCR) | DEMCR_TRCENA, uint32_t);
+    REG_WRITE(ITM_LAR, ITM_LAR_KEY, uint32_t);
+
+#if TM4C_ITM_SWO_BAUD > 0
+    REG_WRITE(TPIU_CSPSR, 1UL, uint32_t);
+    REG_WRITE(TPIU_ACPR, TM4C_SYSCLK_HZ / TM4C_ITM_SWO_BAUD - 1, uint32_t);
+    REG_WRITE(TPIU_SPPR, TPIU_SPPR_NRZ, uint32_t);
+    REG_WRITE(TPIU_FFCR, TPIU_FFCR_TRIGIN, uint32_t);
+
+    REG_WRITE(ITM_TCR, ITM_TCR_BUSID(1) | ITM_TCR_SWOENA | ITM_TCR_ITMENA, uint32_t);
+    REG_WRITE(ITM_TPR, 0UL, uint32_t);
+    REG_WRITE(ITM_TER, 0xFFFFFFFFUL, uint32_t);
+#endif
+    // otherwise the debugger enables the ITM and the ports it captures
+
+    initialized = 1;
+}
+
+size_t tm4c_itm_write(uint32_t port, const void *data, size_t size) {
+    const uint8_t *bytes = (const uint8_t *)data;
+    size_t written = 0;
+
+    if (port >= TM4C_ITM_PORTS) {
+        return 0;
+    }
+
+    tm4c_itm_init();
+    if (!port_enabled(port)) {
+        return size;
+    }
+
+    while (written < size) {
+        if (!port_ready(port, policy)) {
+            dropped = dropped + (uint32_t)(size - written);
+            break;
+        }
+
+        // one 4 byte packet instead of four 1 byte packets where possible
+        if (size - written >= 4) {
+            uint32_t word;
+
+            memcpy(&word, &bytes[written], 4);
+            REG_WRITE(ITM_STIM(port), word, uint32_t);
+            written += 4;
+        } else {
+            REG_WRITE(ITM_STIM(port), bytes[written], uint8_t);
+            written++;
+        }
+    }
+
+    return written;
+}
+
+void tm4c_itm_counter(uint32_t counter, uint32_t value) {
+    const uint32_t port = TM4C_ITM_PORT_COUNTER(counter);
+
+    if (counter >= TM4C_ITM_COUNTERS) {
+        return;
+    }
+
+    tm4c_itm_init();
+    if (!port_enabled(port)) {
+        return;
+    }
+
+    if (port_ready(port, TM4C_ITM_DROP)) {
+        REG_WRITE(ITM_STIM(port), value, uint32_t);
+    } else {
+        dropped = dropped + 4;
+    }
+}
+
+size_t tm4c_itm_log_sink(const void *data, size_t size) {
+    return tm4c_itm_write(TM4C_ITM_PORT_LOG, data, size);
+}
+
+void tm4c_itm_set_policy(tm4c_itm_policy_t new_policy) {
+    policy = new_policy;
+}
+
+uint32_t tm4c_itm_dropped(void) {
+    return dropped;
+}
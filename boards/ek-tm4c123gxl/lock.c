@@ -0,0 +1,287 @@
+/**
+ * @file lock.c
+ * @author Esteban Duran (@astroesteban)
+ * @brief The newlib locks described in tm4c_lock.h.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @ref https://sourceware.org/newlib/libc.html#Retargetable-Locking-Protocols
+ *
+ * @copyright Apache License
+ *
+ */
+#include "tm4c_lock.h"
+
+#include <assert.h>
+#include <stddef.h>
+
+// +--------------------------------------------------------------------------+
+// +			        Type Definitions and Macros                           +
+// +--------------------------------------------------------------------------+
+
+static_assert(TM4C_LIBC_LOCK_PRIORITY >= 1 && TM4C_LIBC_LOCK_PRIORITY < (1 << TM4C_PRIORITY_BITS),
+              "TM4C_LIBC_LOCK_PRIORITY must be 1 to 7, BASEPRI 0 masks nothing");
+static_assert(TM4C_LIBC_LOCKS <= 32, "The pool of runtime locks is tracked in one word");
+
+/*
+ * The host tests (test/host) build this file against simulated special
+ * registers, newlib's <sys/lock.h> does not exist there either.
+ */
+#if defined(TM4C_LOCK_SIMULATED)
+struct __lock;
+typedef struct __lock *_LOCK_T;
+
+uint32_t tm4c_lock_sim_basepri(void);
+void tm4c_lock_sim_set_basepri(uint32_t value);
+uint32_t tm4c_lock_sim_ipsr(void);
+uint32_t tm4c_lock_sim_cycles(void);
+
+/* BASEPRI_MAX only ever raises the priority that is masked */
+static inline void basepri_raise(uint32_t value) {
+    const uint32_t current = tm4c_lock_sim_basepri();
+
+    if (current == 0 || value < current) {
+        tm4c_lock_sim_set_basepri(value);
+    }
+}
+
+#define BASEPRI_GET() tm4c_lock_sim_basepri()
+#define BASEPRI_SET(value) tm4c_lock_sim_set_basepri(value)
+#define BASEPRI_RAISE(value) basepri_raise(value)
+#define IPSR_GET() tm4c_lock_sim_ipsr()
+#define CYCLES() tm4c_lock_sim_cycles()
+#else
+#include <sys/lock.h>
+
+#include "tm4c_cycles.h"
+
+static inline uint32_t basepri_get(void) {
+    uint32_t value;
+
+    __asm volatile ("mrs %0, basepri" : "=r"(value));
+    return value;
+}
+
+static inline void basepri_set(uint32_t value) {
+    __asm volatile ("msr basepri, %0" :: "r"(value) : "memory");
+}
+
+static inline void basepri_raise(uint32_t value) {
+    __asm volatile ("msr basepri_max, %0" :: "r"(value) : "memory");
+}
+
+static inline uint32_t ipsr_get(void) {
+    uint32_t value;
+
+    __asm volatile ("mrs %0, ipsr" : "=r"(value));
+    return value;
+}
+
+#define BASEPRI_GET() basepri_get()
+#define BASEPRI_SET(value) basepri_set(value)
+#define BASEPRI_RAISE(value) basepri_raise(value)
+#define IPSR_GET() ipsr_get()
+#define CYCLES() tm4c_cycles()
+#endif
+
+/**
+ * @brief A lock. Holding it means BASEPRI is at least the lock priority, so
+ *        the owner cannot be preempted by another user of the C library.
+ *        BASEPRI is saved and restored for all locks together (see held), a
+ *        lock only tracks its own recursion.
+ */
+struct __lock {
+    uint32_t depth;                 // acquisitions of the owner not released yet
+    uint32_t owner;                 // IPSR of the owner, 0 in thread mode
+#if defined(TM4C_LIBC_LOCK_DEBUG)
+    uint32_t acquisitions;
+    uint32_t contentions;
+    uint32_t acquired_at;
+    uint32_t max_hold_cycles;
+#endif
+};
+
+struct _reent;
+
+
+// +--------------------------------------------------------------------------+
+// +					Global Variables definition	    				      +
+// +--------------------------------------------------------------------------+
+
+/* The static locks newlib refers to by name, all of them have to be defined */
+struct __lock __lock___sinit_recursive_mutex;
+struct __lock __lock___sfp_recursive_mutex;
+struct __lock __lock___atexit_recursive_mutex;
+struct __lock __lock___at_quick_exit_mutex;
+struct __lock __lock___malloc_recursive_mutex;
+struct __lock __lock___env_recursive_mutex;
+struct __lock __lock___tz_mutex;
+struct __lock __lock___dd_hash_mutex;
+struct __lock __lock___arc4random_mutex;
+
+/* Locks created at runtime. Once the pool is used up they share one lock,
+   which only costs concurrency the BASEPRI scheme does not have anyway */
+static struct __lock pool[TM4C_LIBC_LOCKS];
+static uint32_t pool_used;
+static struct __lock shared;
+
+/* Acquisitions of all locks not released yet and BASEPRI before the first.
+   newlib releases locks out of order (_fclose_r releases the FILE lock
+   before the sfp lock), so BASEPRI is only restored once none is held */
+static uint32_t held;
+static uint32_t saved_basepri;
+
+#if defined(TM4C_LIBC_LOCK_DEBUG)
+static struct __lock *const static_locks[] = {
+    &__lock___sinit_recursive_mutex, &__lock___sfp_recursive_mutex,
+    &__lock___atexit_recursive_mutex, &__lock___at_quick_exit_mutex,
+    &__lock___malloc_recursive_mutex, &__lock___env_recursive_mutex,
+    &__lock___tz_mutex, &__lock___dd_hash_mutex, &__lock___arc4random_mutex,
+    &shared,
+};
+#endif
+
+
+// +--------------------------------------------------------------------------+
+// +                          Function Definitions                            +
+// +--------------------------------------------------------------------------+
+static void lock_acquire(struct __lock *lock) {
+    const uint32_t previous = BASEPRI_GET();
+    const uint32_t context = IPSR_GET();
+
+    BASEPRI_RAISE(TM4C_LIBC_LOCK_BASEPRI);
+
+    if (held++ == 0) {
+        saved_basepri = previous;
+    }
+
+    if (lock->depth == 0) {
+        lock->owner = context;
+#if defined(TM4C_LIBC_LOCK_DEBUG)
+        lock->acquisitions++;
+        lock->acquired_at = CYCLES();
+#endif
+    } else if (lock->owner != context) {
+        // an interrupt above the lock priority preempted the owner. Waiting
+        // would never end, so go ahead and count it as the bug it is
+#if defined(TM4C_LIBC_LOCK_DEBUG)
+        lock->contentions++;
+#endif
+    }
+
+    lock->depth++;
+}
+
+static void lock_release(struct __lock *lock) {
+    if (lock->depth == 0) {
+        return;                     // a release too many must not unmask
+    }
+
+#if defined(TM4C_LIBC_LOCK_DEBUG)
+    if (lock->depth == 1) {
+        const uint32_t hold = CYCLES() - lock->acquired_at;
+
+        if (hold > lock->max_hold_cycles) {
+            lock->max_hold_cycles = hold;
+        }
+    }
+#endif
+
+    lock->depth--;
+    if (--held == 0) {
+        BASEPRI_SET(saved_basepri);
+    }
+}
+
+void __retarget_lock_init(_LOCK_T *lock) {
+    const uint32_t previous = BASEPRI_GET();
+
+    BASEPRI_RAISE(TM4C_LIBC_LOCK_BASEPRI);
+
+    *lock = &shared;
+    for (uint32_t i = 0; i < TM4C_LIBC_LOCKS; i++) {
+        if ((pool_used & (1UL << i)) == 0) {
+            pool_used |= 1UL << i;
+            pool[i] = (struct __lock){0};
+            *lock = &pool[i];
+            break;
+        }
+    }
+
+    BASEPRI_SET(previous);
+}
+
+void __retarget_lock_init_recursive(_LOCK_T *lock) {
+    __retarget_lock_init(lock);
+}
+
+void __retarget_lock_close(_LOCK_T lock) {
+    const uint32_t previous = BASEPRI_GET();
+
+    BASEPRI_RAISE(TM4C_LIBC_LOCK_BASEPRI);
+    if (lock >= &pool[0] && lock < &pool[TM4C_LIBC_LOCKS]) {
+        pool_used &= ~(1UL << (uint32_t)(lock - pool));
+    }
+    BASEPRI_SET(previous);
+}
+
+void __retarget_lock_close_recursive(_LOCK_T lock) {
+    __retarget_lock_close(lock);
+}
+
+void __retarget_lock_acquire(_LOCK_T lock) {
+    lock_acquire(lock);
+}
+
+void __retarget_lock_acquire_recursive(_LOCK_T lock) {
+    lock_acquire(lock);
+}
+
+/* Never has to wait, so trying always succeeds (0, like pthread_mutex_trylock) */
+int __retarget_lock_try_acquire(_LOCK_T lock) {
+    lock_acquire(lock);
+    return 0;
+}
+
+int __retarget_lock_try_acquire_recursive(_LOCK_T lock) {
+    lock_acquire(lock);
+    return 0;
+}
+
+void __retarget_lock_release(_LOCK_T lock) {
+    lock_release(lock);
+}
+
+void __retarget_lock_release_recursive(_LOCK_T lock) {
+    lock_release(lock);
+}
+
+void __malloc_lock(struct _reent *reent) {
+    (void)reent;
+    lock_acquire(&__lock___malloc_recursive_mutex);
+}
+
+void __malloc_unlock(struct _reent *reent) {
+    (void)reent;
+    lock_release(&__lock___malloc_recursive_mutex);
+}
+
+tm4c_lock_stats_t tm4c_lock_stats(void) {
+    tm4c_lock_stats_t stats = {0};
+
+#if defined(TM4C_LIBC_LOCK_DEBUG)
+    const size_t count = sizeof(static_locks) / sizeof(static_locks[0]);
+
+    for (size_t i = 0; i < count + TM4C_LIBC_LOCKS; i++) {
+        const struct __lock *const lock = i < count ? static_locks[i] : &pool[i - count];
+
+        stats.acquisitions += lock->acquisitions;
+        stats.contentions += lock->contentions;
+        if (lock->max_hold_cycles > stats.max_hold_cycles) {
+            stats.max_hold_cycles = lock->max_hold_cycles;
+        }
+    }
+#endif
+
+    return stats;
+}
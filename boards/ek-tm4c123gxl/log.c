@@ -0,0 +1,110 @@
+/**
+ * @file log.c
+ * @author Esteban Duran (@astroesteban)
+ * @brief The deferred binary log described in tm4c_log.h.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#include "tm4c_log.h"
+
+#include <assert.h>
+
+#include "tm4c_sections.h"
+
+// +--------------------------------------------------------------------------+
+// +			        Type Definitions and Macros                           +
+// +--------------------------------------------------------------------------+
+
+static_assert((TM4C_LOG_WORDS & (TM4C_LOG_WORDS - 1)) == 0 && TM4C_LOG_WORDS >= 16,
+              "TM4C_LOG_BUFFER must be a power of two of at least 64 bytes");
+
+#define LOG_MASK        (TM4C_LOG_WORDS - 1)
+#define LOG_ID_MASK     0xFFFFFUL
+#define LOG_HEADER(id, count) \
+    ((TM4C_LOG_MARKER << 24) | ((uint32_t)(count) << 20) | ((id) & LOG_ID_MASK))
+
+/*
+ * The host tests (test/host) build this file without the chip: records get
+ * a running number instead of a cycle count and nothing can interrupt.
+ */
+#if defined(TM4C_LOG_SIMULATED)
+static uint32_t sim_cycles;
+#define LOG_TIMESTAMP() (sim_cycles++)
+#define LOG_LOCK() 0UL
+#define LOG_UNLOCK(primask) ((void)(primask))
+#else
+#include "tm4c_cycles.h"
+#define LOG_TIMESTAMP() tm4c_cycles()
+
+static inline uint32_t log_lock(void) {
+    uint32_t primask;
+
+    __asm volatile ("mrs %0, primask\n\tcpsid i" : "=r"(primask) :: "memory");
+    return primask;
+}
+
+static inline void log_unlock(uint32_t primask) {
+    __asm volatile ("msr primask, %0" :: "r"(primask) : "memory");
+}
+
+#define LOG_LOCK() log_lock()
+#define LOG_UNLOCK(primask) log_unlock(primask)
+#endif
+
+
+// +--------------------------------------------------------------------------+
+// +					Global Variables definition	    				      +
+// +--------------------------------------------------------------------------+
+
+/* Persistent so the records of the last run can be read after a crash */
+TM4C_PERSISTENT tm4c_log_t tm4c_log;
+
+
+// +--------------------------------------------------------------------------+
+// +                          Function Definitions                            +
+// +--------------------------------------------------------------------------+
+TM4C_HOT void tm4c_log_write(uint32_t id, const uint32_t *args, uint32_t count) {
+    const uint32_t primask = LOG_LOCK();
+    uint32_t head = tm4c_log.head;
+
+    // the interrupts are off, so records from different priorities never mix
+    if (TM4C_LOG_WORDS - (head - tm4c_log.tail) < count + 2) {
+        tm4c_log.dropped = tm4c_log.dropped + 1;
+        LOG_UNLOCK(primask);
+        return;
+    }
+
+    tm4c_log.buffer[head++ & LOG_MASK] = LOG_HEADER(id, count);
+    tm4c_log.buffer[head++ & LOG_MASK] = LOG_TIMESTAMP();
+    while (count-- != 0) {
+        tm4c_log.buffer[head++ & LOG_MASK] = *args++;
+    }
+    tm4c_log.head = head;
+
+    LOG_UNLOCK(primask);
+}
+
+size_t tm4c_log_drain(tm4c_log_sink_t sink) {
+    const uint32_t head = tm4c_log.head;
+    uint32_t tail = tm4c_log.tail;
+    size_t drained = 0;
+
+    // at most two contiguous spans, the second one after the wrap
+    while (tail != head) {
+        const uint32_t start = tail & LOG_MASK;
+        uint32_t words = head - tail;
+
+        if (words > TM4C_LOG_WORDS - start) {
+            words = TM4C_LOG_WORDS - start;
+        }
+
+        drained += sink(&tm4c_log.buffer[start], words * 4);
+        tail += words;
+        tm4c_log.tail = tail;
+    }
+
+    return drained;
+}
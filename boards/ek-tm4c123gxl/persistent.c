@@ -0,0 +1,103 @@
+/**
+ * @file persistent.c
+ * @author Esteban Duran (@astroesteban)
+ * @brief Cold/warm boot detection for the persistent SRAM region.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#include "tm4c_persistent.h"
+
+#include "tm4c_crc.h"
+
+// +--------------------------------------------------------------------------+
+// +			        Type Definitions and Macros                           +
+// +--------------------------------------------------------------------------+
+#define SYSCTL_RESC (*((volatile uint32_t *)0x400FE05C)) // Reset Cause
+
+#define PERSISTENT_MAGIC 0x50455253UL   // "PERS"
+
+/* Defines a type for the header at the start of the persistent region */
+typedef struct {
+    uint32_t magic;
+    uint32_t size;          // size of the region, catches layout changes
+    uint32_t warm_boots;
+    uint32_t crc;           // CRC over the fields above, updated with them
+} persistent_header_t;
+
+
+// +--------------------------------------------------------------------------+
+// +					External Variables declaration					      +
+// +--------------------------------------------------------------------------+
+//persistent region, header included
+extern uint32_t _persistent[];
+extern uint32_t _epersistent[];
+
+
+// +--------------------------------------------------------------------------+
+// +					Global Variables definition	    				      +
+// +--------------------------------------------------------------------------+
+
+// * placed first in the persistent region by the linker script
+__attribute__((section(".persistent_header"), used))
+static volatile persistent_header_t header;
+
+static tm4c_boot_kind_t boot_kind;
+static uint32_t reset_cause;
+
+
+// +--------------------------------------------------------------------------+
+// +                          Function Definitions                            +
+// +--------------------------------------------------------------------------+
+/* Magic and size are constants, the CRC is what catches a corrupted
+   warm_boots (and random power-up content that matches both) */
+static uint32_t header_crc(void) {
+    const uint32_t words[3] = {header.magic, header.size, header.warm_boots};
+    return tm4c_crc32(0, words, sizeof(words));
+}
+
+void tm4c_persistent_init(void) {
+    const uint32_t size = (uint32_t)((uintptr_t)_epersistent - (uintptr_t)_persistent);
+
+    // the reset cause bits are sticky, clear them for the next reset
+    reset_cause = SYSCTL_RESC;
+    SYSCTL_RESC = 0;
+
+    // SRAM content is undefined after a power-on or brown-out reset
+    if ((reset_cause & (TM4C_RESET_POWER_ON | TM4C_RESET_BROWN_OUT)) == 0 &&
+        header.magic == PERSISTENT_MAGIC && header.size == size &&
+        header.crc == header_crc()) {
+        header.warm_boots++;
+        header.crc = header_crc();
+        boot_kind = TM4C_BOOT_WARM;
+        return;
+    }
+
+    for (uint32_t *word = _persistent; word < _epersistent; word++) {
+        *word = 0;
+    }
+
+    header.magic = PERSISTENT_MAGIC;
+    header.size = size;
+    header.warm_boots = 0;
+    header.crc = header_crc();
+    boot_kind = TM4C_BOOT_COLD;
+}
+
+tm4c_boot_kind_t tm4c_persistent_boot(void) {
+    return boot_kind;
+}
+
+uint32_t tm4c_reset_cause(void) {
+    return reset_cause;
+}
+
+uint32_t tm4c_persistent_warm_boots(void) {
+    return header.warm_boots;
+}
+
+void tm4c_persistent_invalidate(void) {
+    header.magic = 0;
+}
@@ -9,6 +9,17 @@
  * @copyright Apache License
  * 
  */
+#include <stddef.h>
+#include <stdint.h>
+
+#include "tm4c_boot.h"
+#include "tm4c_clock.h"
+#include "tm4c_cycles.h"
+#include "tm4c_gpio.h"
+#include "tm4c_interrupts.h"
+#include "tm4c_persistent.h"
+#include "tm4c_time.h"
+
 // +--------------------------------------------------------------------------+
 // +			        Type Definitions and Macros                           +
 // +--------------------------------------------------------------------------+
@@ -20,7 +31,7 @@
 #define DEFAULT __attribute__((weak, alias("Default_Handler")))
 
 /* Defines a type for the ISR's in the vector table */
-typedef void (*element_t)(void);
+typedef tm4c_isr_t element_t;
 
 /* Defines a type for the vector table */
 typedef union {
@@ -28,24 +39,62 @@ typedef union {
     void *stack_top; //pointer to top of the stack
 } vector_table_t;
 
+/*
+ * Entries of the initialization tables the linker script emits. Every region
+ * is word aligned and a multiple of words long (see tm4c123gh6pm.ld).
+*/
+typedef struct {
+    const uint32_t *load;   // load address in FLASH
+    uint32_t *start;        // run address in SRAM
+    uint32_t *end;          // end of the run address range
+} copy_region_t;
+
+typedef struct {
+    uint32_t *start;
+    uint32_t *end;
+} zero_region_t;
+
+/*
+ * System Control Block registers used while bringing the core up. See the
+ * TM4C123GH6PM datasheet section 3.6 (Floating-Point Unit Registers).
+*/
+#define SCB_CPACR  (*((volatile uint32_t *)0xE000ED88)) // Coprocessor Access Control
+#define FPU_FPCCR  (*((volatile uint32_t *)0xE000EF34)) // FP Context Control
+
+#define SCB_CPACR_CP10_CP11_FULL (0xFUL << 20)          // CP10 + CP11 full access
+#define FPU_FPCCR_ASPEN          (1UL << 31)            // automatic state preservation
+#define FPU_FPCCR_LSPEN          (1UL << 30)            // lazy state preservation
+
+/*
+ * The FPU context saving mode is picked at configure time through the
+ * TM4C_FPU_CONTEXT CMake option.
+*/
+#if defined(TM4C_FPU_CONTEXT_ALWAYS)
+#define FPU_FPCCR_MODE (FPU_FPCCR_ASPEN)
+#elif defined(TM4C_FPU_CONTEXT_OFF)
+#define FPU_FPCCR_MODE (0UL)
+#else
+#define FPU_FPCCR_MODE (FPU_FPCCR_ASPEN | FPU_FPCCR_LSPEN)
+#endif
+
 
 // +--------------------------------------------------------------------------+
 // +			        Prototypes of Basic Exception Handlers                +
 // +--------------------------------------------------------------------------+
 
-//Default Handler,does nothing
+//Default Handler, records a crash and resets (fault.c)
 void Default_Handler(void);
 
 //System Exception Handlers
 void Reset_Handler(void);
-void NMI_Handler(void);
+DEFAULT void NMI_Handler(void);
 DEFAULT void SVC_Handler(void);
 DEFAULT void DebugMonitor_Handler(void);
 DEFAULT void PendSV_Handler(void);
 DEFAULT void SysTick_Handler(void);
 
 //Fault Handlers
-void HardFault_Handler(void);
+DEFAULT void HardFault_Handler(void);
 DEFAULT void MemManageFault_Handler(void);
 DEFAULT void BusFault_Handler(void);
 DEFAULT void UsageFault_Handler(void);
@@ -138,16 +187,21 @@ DEFAULT void PWM1Fault_ISR(void);
 
 //main() of your program
 extern int main(void);
+//runs .preinit_array and .init_array (C++ constructors), provided by newlib
+extern void __libc_init_array(void);
 //stack pointer
 extern int _stack_ptr;
-//.text/code,stored in Flash
-extern int _etext;
-//.data,copied into RAM on boot
-extern int _data;
-extern int _edata;
-//.bss,unitialized variables
-extern int _bss;
-extern int _ebss;
+//regions copied from Flash into RAM on boot (.data)
+extern const copy_region_t __copy_table_start[];
+extern const copy_region_t __copy_table_end[];
+//regions zeroed on boot (.bss)
+extern const zero_region_t __zero_table_start[];
+extern const zero_region_t __zero_table_end[];
+
+// +--------------------------------------------------------------------------+
+// +					Global Variables definition	    				      +
+// +--------------------------------------------------------------------------+
+tm4c_boot_times_t tm4c_boot_times;
 
 
 // +--------------------------------------------------------------------------+
@@ -157,7 +211,7 @@ extern int _ebss;
 // * marks this vector table as part of the .vector_table section in the ld
 // * The vector table is defined in the datasheet table 2-9.
 __attribute__((section(".vector_table")))
-const vector_table_t vectors[] = {
+const vector_table_t vectors[TM4C_VECTOR_COUNT] = {
     {.stack_top = &_stack_ptr}, // 0    Pointer to top of Stack
     Reset_Handler,              // 1    Reset handler is called when the <RESET> button is pressed
     NMI_Handler,                // 2    Non-Maskable Interrupt handler
@@ -316,22 +370,178 @@ const vector_table_t vectors[] = {
 };
 
 
+#if defined(TM4C_RAM_VECTORS)
+// * SRAM copy of the vector table that VTOR points to after boot. VTOR needs
+// * the table aligned to its size rounded up to a power of two, i.e. 1 KB.
+__attribute__((section(".ram_vectors"), aligned(1024)))
+static volatile vector_table_t ram_vectors[TM4C_VECTOR_COUNT];
+#endif
+
+
 // +--------------------------------------------------------------------------+
-// +                Implementations of Interrupt Service Routines             +
+// +                          Boot Stages                                     +
 // +--------------------------------------------------------------------------+
-void Reset_Handler(void) {
-    int *src, *dest;
 
-    /* copying of the .data values into RAM */
-    src = &_etext;
-    for (dest = &_data; dest < &_edata;) {
+/**
+ * @brief Grants the core access to the FPU and configures how its context is
+ *        saved on exception entry.
+ *
+ * @note Everything is compiled with -mfloat-abi=hard so this has to run before
+ *       the first floating point instruction, otherwise we take a UsageFault
+ *       (NOCP). Keep it free of float code for the same reason.
+ */
+static inline void fpu_init(void) {
+    // FPCCR has to be configured before the first floating point instruction
+    // creates an FP context, so we set it up before enabling CP10/CP11
+    FPU_FPCCR = (FPU_FPCCR & ~(FPU_FPCCR_ASPEN | FPU_FPCCR_LSPEN)) | FPU_FPCCR_MODE;
+    SCB_CPACR |= SCB_CPACR_CP10_CP11_FULL;
+
+    // make sure the new access rights are visible before we continue
+    __asm volatile ("dsb\n\tisb" ::: "memory");
+}
+
+
+/**
+ * @brief Copies a word aligned region 8 words (32 bytes) at a time with
+ *        LDM/STM bursts and finishes the remainder word by word.
+ *
+ * @note r7 is left out of the register list because it is the frame pointer
+ *       in Thumb code built without optimizations.
+ */
+static void burst_copy(uint32_t *dest, const uint32_t *src, size_t words) {
+    size_t bursts = words / 8;
+
+    if (bursts != 0) {
+        __asm volatile (
+            "1: ldmia %[src]!, {r3-r6, r8-r10, r12}   \n\t"
+            "   stmia %[dest]!, {r3-r6, r8-r10, r12}  \n\t"
+            "   subs  %[n], %[n], #1                  \n\t"
+            "   bne   1b                              \n\t"
+            : [src] "+r" (src), [dest] "+r" (dest), [n] "+r" (bursts)
+            :
+            : "r3", "r4", "r5", "r6", "r8", "r9", "r10", "r12", "cc", "memory");
+    }
+
+    for (words %= 8; words != 0; words--) {
         *dest++ = *src++;
     }
+}
+
+/**
+ * @brief Zeroes a word aligned region with 8 word STM bursts.
+ */
+static void burst_zero(uint32_t *dest, size_t words) {
+    size_t bursts = words / 8;
+
+    if (bursts != 0) {
+        __asm volatile (
+            "   movs  r3, #0                          \n\t"
+            "   movs  r4, #0                          \n\t"
+            "   movs  r5, #0                          \n\t"
+            "   movs  r6, #0                          \n\t"
+            "   mov   r8, r3                          \n\t"
+            "   mov   r9, r3                          \n\t"
+            "   mov   r10, r3                         \n\t"
+            "   mov   r12, r3                         \n\t"
+            "1: stmia %[dest]!, {r3-r6, r8-r10, r12}  \n\t"
+            "   subs  %[n], %[n], #1                  \n\t"
+            "   bne   1b                              \n\t"
+            : [dest] "+r" (dest), [n] "+r" (bursts)
+            :
+            : "r3", "r4", "r5", "r6", "r8", "r9", "r10", "r12", "cc", "memory");
+    }
 
-    /* initializing .bss values to zero*/
-    for (dest = &_bss; dest < &_ebss;) {
+    for (words %= 8; words != 0; words--) {
         *dest++ = 0;
     }
+}
+
+#if defined(TM4C_RAM_VECTORS)
+/**
+ * @brief Copies the vector table into SRAM and points VTOR at the copy, from
+ *        now on handlers can be swapped with tm4c_irq_attach().
+ */
+static inline void vectors_init(void) {
+    burst_copy((uint32_t *)ram_vectors, (const uint32_t *)vectors, TM4C_VECTOR_COUNT);
+    TM4C_SCB_VTOR = (uint32_t)ram_vectors;
+    __asm volatile ("dsb\n\tisb" ::: "memory");
+}
+#endif
+
+/**
+ * @brief Copies every region of the copy table from FLASH into SRAM.
+ */
+static inline void data_init(void) {
+    for (const copy_region_t *region = __copy_table_start; region < __copy_table_end; region++) {
+        burst_copy(region->start, region->load, (size_t)(region->end - region->start));
+    }
+}
+
+/**
+ * @brief Zeroes every region of the zero table.
+ */
+static inline void bss_init(void) {
+    for (const zero_region_t *region = __zero_table_start; region < __zero_table_end; region++) {
+        burst_zero(region->start, (size_t)(region->end - region->start));
+    }
+}
+
+
+// +--------------------------------------------------------------------------+
+// +                Implementations of Interrupt Service Routines             +
+// +--------------------------------------------------------------------------+
+void Reset_Handler(void) {
+    uint32_t start, fpu, clock, data, bss, persistent, ram_vectors_done, constructors;
+
+    /* time every boot stage, tm4c_boot_times is published before main() */
+    tm4c_cycles_start();
+    start = tm4c_cycles();
+
+    /* enable the FPU before any code can touch a float */
+    fpu_init();
+    fpu = tm4c_cycles();
+
+    /* switch to the configured clock so the rest of the boot runs at speed */
+    tm4c_clock_init();
+    clock = tm4c_cycles();
+
+    /* the time base counts core clock cycles, start it at the final clock */
+    tm4c_time_init();
+
+    /* put the GPIO ports on their configured bus before any code uses them */
+    tm4c_gpio_bus_init();
+
+    /* copying of the .data values into RAM */
+    data_init();
+    data = tm4c_cycles();
+
+    /* initializing .bss values to zero*/
+    bss_init();
+    bss = tm4c_cycles();
+
+    /* keep or clear the persistent variables depending on the reset cause */
+    tm4c_persistent_init();
+    persistent = tm4c_cycles();
+
+#if defined(TM4C_RAM_VECTORS)
+    /* run from the SRAM copy of the vector table */
+    vectors_init();
+#endif
+    ram_vectors_done = tm4c_cycles();
+
+    /* run the static constructors, memory is fully set up by now */
+    __libc_init_array();
+    constructors = tm4c_cycles();
+
+    /* tm4c_boot_times lives in .bss so it can only be written now */
+    tm4c_boot_times.fpu = fpu - start;
+    tm4c_boot_times.clock = clock - fpu;
+    tm4c_boot_times.data = data - clock;
+    tm4c_boot_times.bss = bss - data;
+    tm4c_boot_times.persistent = persistent - bss;
+    tm4c_boot_times.vectors = ram_vectors_done - persistent;
+    tm4c_boot_times.constructors = constructors - ram_vectors_done;
+    tm4c_boot_times.total = tm4c_cycles() - start;
 
     /* your program's main() called */
     main();
@@ -340,14 +550,41 @@ void Reset_Handler(void) {
     while (1);
 }
 
-void Default_Handler(void) {
-    while (1);
+#if defined(TM4C_RAM_VECTORS)
+tm4c_isr_t tm4c_irq_attach(tm4c_irq_t irq, tm4c_isr_t handler) {
+    const int32_t vector = (int32_t)irq + 16;
+    tm4c_isr_t previous;
+
+    // the initial stack pointer and the reset vector cannot be replaced
+    if (vector < 2 || vector >= TM4C_VECTOR_COUNT) {
+        return 0;
+    }
+
+    previous = ram_vectors[vector].isr;
+    ram_vectors[vector].isr = handler;
+
+    // the new handler has to be in place before the next exception entry
+    __asm volatile ("dsb" ::: "memory");
+
+    return previous;
 }
 
-void NMI_Handler(void) {
-    while (1);
+tm4c_isr_t tm4c_irq_handler(tm4c_irq_t irq) {
+    const int32_t vector = (int32_t)irq + 16;
+
+    if (vector < 2 || vector >= TM4C_VECTOR_COUNT) {
+        return 0;
+    }
+
+    return ram_vectors[vector].isr;
 }
+#endif
 
-void HardFault_Handler(void) {
-    while (1);
-}
\ No newline at end of file
+/*
+ * Every exception without a handler of its own (including the faults) ends
+ * up here. The jump must not touch the stack, the capture in fault.c needs
+ * to see the exception frame exactly as the core pushed it.
+ */
+__attribute__((naked)) void Default_Handler(void) {
+    __asm volatile ("b tm4c_fault_entry");
+}
@@ -13,8 +13,21 @@
  * @ref https://github.com/mroy/stellarap/blob/master/newlib_stubs.c
  */
 #include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <unistd.h>
 #include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/times.h>
+
+#include "tm4c_heap.h"
+#include "tm4c_itm.h"
+#include "tm4c_time.h"
+#include "tm4c_uart.h"
+
+#if TM4C_FS_SIZE > 0
+#include "tm4c_fs.h"
+#endif
 
 // We have to disable the C library's errno in favor of a global variable
 #undef errno
@@ -31,6 +44,38 @@ char *__env[1] = { 0 };
 char **environ = __env;
 
 
+/**
+ * @brief Bounds of the heap region, defined in tm4c123gh6pm.ld.
+ */
+extern uint8_t __heap_start[];
+extern uint8_t __heap_end[];
+
+
+/**
+ * @brief The current program break and the heap statistics.
+ */
+static uint8_t *heap_break = __heap_start;
+static tm4c_heap_stats_t heap_stats;
+
+
+#if TM4C_FS_SIZE > 0
+/**
+ * @brief Turns what the filesystem returns (see tm4c_fs.h) into the result of
+ *        a system call.
+ * 
+ * @param result A negative errno value or the result on success.
+ * @return int The result on success, -1 with errno set on error.
+ */
+static int fs_result(int result) {
+  if (result < 0) {
+    errno = -result;
+    return -1;
+  }
+  return result;
+}
+#endif
+
+
 /**
  * @brief Exit a program without cleaning up files.
  * 
@@ -43,12 +88,19 @@ void _exit(int status)
 
 
 /**
- * @brief Close the file. This is a minimal implementation. Returns -1.
+ * @brief Close the file. Files of the flash filesystem (tm4c_fs.h) are
+ *        closed, stdin, stdout and stderr stay open.
  * 
  * @param file File descriptor
  * @return Returns zero on success or -1 on error and errno is set.
  */
 int _close(int file) {
+#if TM4C_FS_SIZE > 0
+    if (file >= TM4C_FS_FD_FIRST) {
+        return fs_result(tm4c_fs_close(file));
+    }
+#endif
+    errno = EBADF;
     return -1;
 }
 
@@ -95,6 +147,11 @@ int _fork(void) {
  *             errno is set appropriately.
  */
 int _fstat(int file, struct stat *buf) {
+#if TM4C_FS_SIZE > 0
+  if (file >= TM4C_FS_FD_FIRST) {
+    return fs_result(tm4c_fs_fstat(file, buf));
+  }
+#endif
   buf->st_mode = S_IFCHR;
   return 0;
 }
@@ -117,9 +174,16 @@ int _getpid(void) {
  * @param file The file descriptor.
  * @return int Returns 1 if fd is an open file descriptor referring to a 
  *             terminal; otherwise 0 is returned, and errno is set to indicate 
- *             the error. Default to 1.
+ *             the error. stdin, stdout and stderr are terminals, files are
+ *             not (so newlib buffers them fully).
  */
 int _isatty(int file) {
+#if TM4C_FS_SIZE > 0
+  if (file >= TM4C_FS_FD_FIRST) {
+    errno = ENOTTY;
+    return 0;
+  }
+#endif
   return 1;
 }
 
@@ -177,41 +241,66 @@ int _link(const char *path1, const char *path2) {
  * @return int Upon successful completion, lseek() returns the resulting offset 
  *             location as measured in bytes from the beginning of the file. On 
  *             error, the value (off_t) -1 is returned and errno is set to 
- *             indicate the error. For now we return 0.
+ *             indicate the error. Always 0 for stdin, stdout and stderr.
  */
 int _lseek(int file, int offset, int whence) {
+#if TM4C_FS_SIZE > 0
+  if (file >= TM4C_FS_FD_FIRST) {
+    return fs_result(tm4c_fs_lseek(file, offset, whence));
+  }
+#endif
   return 0;
 }
 
 
 /**
- * @brief Opens a file.
+ * @brief Opens a file of the flash filesystem (see tm4c_fs.h).
  * 
  * @param fileName The name of the file.
  * @param flags The access mode of the file.
  * @param mode Specifies the permissions to use in case a new file is created.
+ *             Ignored, all files can be read and written.
  * @return int Return the new file descriptor, or -1 if an error occurred 
- *             (in which case, errno is set appropriately). For now we return
- *             -1.
+ *             (in which case, errno is set appropriately). Without a
+ *             filesystem (TM4C_FS_SIZE=0) errno is always ENOENT.
  */
 int _open(const char *fileName, int flags, int mode) {
+  (void)mode;
+#if TM4C_FS_SIZE > 0
+  return fs_result(tm4c_fs_open(fileName, flags));
+#else
+  errno = ENOENT;
   return -1;
+#endif
 }
 
 
 /**
  * @brief Read from a file.
  * 
+ * @details stdin is read from UART0 (see tm4c_uart.h). In cooked mode every
+ *          read returns (at most) one line. Other descriptors are files of
+ *          the flash filesystem (see tm4c_fs.h).
+ * 
  * @param file The file to read from.
  * @param buf The buffer to read the data into. 
  * @param numBytes The number of bytes to read from the file.
  * @return int On success, the number of bytes read is returned (zero indicates 
  *             end of file), and the file position is advanced by this number.
- *             On error, -1 is returned, and errno is set appropriately. For
- *             now we return 0.
+ *             On error, -1 is returned, and errno is set appropriately.
  */
 int _read(int file, char *buf, size_t numBytes) {
-  return 0;
+#if TM4C_FS_SIZE > 0
+  if (file >= TM4C_FS_FD_FIRST) {
+    return fs_result(tm4c_fs_read(file, buf, numBytes));
+  }
+#endif
+  if (file != STDIN_FILENO) {
+    errno = EBADF;
+    return -1;
+  }
+
+  return (int)tm4c_uart0_read(buf, numBytes);
 }
 
 
@@ -219,28 +308,52 @@ int _read(int file, char *buf, size_t numBytes) {
  * @brief Increase the program’s data space by increment bytes. In other words
  *        it increments the size of the heap.
  * 
- * @details More often than not, we want the heap to use all the RAM not used 
- *          by anything else. We therefore set HEAP_START to the first address 
- *          not spoken for in our linker script.
+ * @details The heap is the region between __heap_start and __heap_end that
+ *          the linker script reserves. The linker already guarantees that it
+ *          ends below the minimum stack reservation. We additionally refuse to
+ *          grow past the current stack pointer in case the stack overflowed
+ *          its reservation.
  * 
  * @param increment Increments the program's data space by increment bytes.
- * @return caddr_t On success, sbrk() returns the previous program break. On 
- *                 error, (void *) -1 is returned, and errno is set to ENOMEM.
+ * @return void* On success, sbrk() returns the previous program break. On 
+ *               error, (void *) -1 is returned, and errno is set to ENOMEM.
  */
-// caddr_t _sbrk(int increment) {
-//     static unsigned char *heap = NULL;
-//     unsigned char *prev_heap;
+void *_sbrk(ptrdiff_t increment) {
+    uint8_t *const previous = heap_break;
+    uint8_t *stack_pointer;
+
+    __asm volatile ("mov %0, sp" : "=r" (stack_pointer));
+
+    // compare sizes instead of pointers so we never form an out of range one
+    if (increment > __heap_end - heap_break || increment < __heap_start - heap_break ||
+        (increment > 0 && increment > stack_pointer - heap_break)) {
+        heap_stats.failed++;
+        errno = ENOMEM;
+        return (void *)-1;
+    }
 
-//     if (heap == NULL) {
-//         // ! FIXME: _end is not working
-//         heap = (unsigned char *)&_edata;
-//     }
-//     prev_heap = heap;
+    heap_break += increment;
 
-//     heap += increment;
+    heap_stats.size = (size_t)(heap_break - __heap_start);
+    if (heap_stats.size > heap_stats.peak) {
+        heap_stats.peak = heap_stats.size;
+    }
 
-//     return prev_heap;
-// }
+    return previous;
+}
+
+
+/**
+ * @brief Returns a snapshot of the heap statistics.
+ * 
+ * @return tm4c_heap_stats_t The current, peak and maximum heap size and the
+ *                           number of refused requests.
+ */
+tm4c_heap_stats_t tm4c_heap_stats(void) {
+    tm4c_heap_stats_t stats = heap_stats;
+    stats.capacity = (size_t)(__heap_end - __heap_start);
+    return stats;
+}
 
 
 /**
@@ -249,25 +362,76 @@ int _read(int file, char *buf, size_t numBytes) {
  * @param file The file to get information about.
  * @param st Stores the file information.
  * @return int On success, zero is returned. On error, -1 is returned, and 
- *             errno is set appropriately. For now we return 0.
+ *             errno is set appropriately.
  */
 int _stat(const char *file, struct stat *st) {
-  st->st_mode = S_IFCHR;
-  return 0;
+#if TM4C_FS_SIZE > 0
+  return fs_result(tm4c_fs_stat(file, st));
+#else
+  errno = ENOENT;
+  return -1;
+#endif
 }
 
 
 /**
  * @brief Timing information for current process.
  * 
+ * @details All time since boot (see tm4c_time.h) counts as user time of the
+ *          one process there is, so clock() returns it in CLOCKS_PER_SEC.
+ * 
  * @param buf Buffer to hold struct tms data.
  * @return int The number of clock ticks that have elapsed since an arbitrary 
  *             point in the past. The return value may overflow the possible 
  *             range of type clock_t. On error, (clock_t) -1 is returned, and 
- *             errno is set appropriately. For now we return -1.
+ *             errno is set appropriately.
  */
 int _times(struct tms *buf) {
-  return -1;
+  const clock_t ticks = (clock_t)(tm4c_time_ticks() / (TM4C_TIME_HZ / CLOCKS_PER_SEC));
+
+  if (buf != NULL) {
+    buf->tms_utime = ticks;
+    buf->tms_stime = 0;
+    buf->tms_cutime = 0;
+    buf->tms_cstime = 0;
+  }
+  return (int)ticks;
+}
+
+
+/**
+ * @brief Current time of day, behind gettimeofday() and the std::chrono
+ *        clocks of libstdc++.
+ * 
+ * @param tv Stores the CLOCK_REALTIME of tm4c_time.h.
+ * @param tz Obsolete, ignored.
+ * @return int Always 0.
+ */
+int _gettimeofday(struct timeval *tv, void *tz) {
+  struct timespec now;
+
+  (void)tz;
+  tm4c_time_get(CLOCK_REALTIME, &now);
+  tv->tv_sec = now.tv_sec;
+  tv->tv_usec = (suseconds_t)(now.tv_nsec / 1000);
+  return 0;
+}
+
+
+/**
+ * @brief Reads one of the clocks of tm4c_time.h.
+ * 
+ * @param clock_id CLOCK_MONOTONIC or CLOCK_REALTIME.
+ * @param tp Stores the time.
+ * @return int On success, zero is returned. On error, -1 is returned, and 
+ *             errno is set appropriately.
+ */
+int clock_gettime(clockid_t clock_id, struct timespec *tp) {
+  if (tm4c_time_get(clock_id, tp) != 0) {
+    errno = EINVAL;
+    return -1;
+  }
+  return 0;
 }
 
 
@@ -276,11 +440,15 @@ int _times(struct tms *buf) {
  * 
  * @param name The file name to delete from the file system.
  * @return int On success, zero is returned. On error, -1 is returned, and 
- *             errno is set appropriately. For now we return -1.
+ *             errno is set appropriately.
  */
 int _unlink(const char *name) {
+#if TM4C_FS_SIZE > 0
+  return fs_result(tm4c_fs_unlink(name));
+#else
   errno = ENOENT;
   return -1;
+#endif
 }
 
 
@@ -302,6 +470,13 @@ int _wait(int *status) {
  *        output, for example to a serial port for debugging, you should make 
  *        your minimal write capable of doing this.
  * 
+ * @details stdout and stderr are queued on UART0 (see tm4c_uart.h), or with
+ *          TM4C_STDIO_BACKEND=ITM written to the text port of the ITM (see
+ *          tm4c_itm.h). Bytes the full ring or FIFO policy drops are still
+ *          reported as written, otherwise newlib would retry them and turn
+ *          the drop policies into blocking. Other descriptors are files of
+ *          the flash filesystem (see tm4c_fs.h).
+ * 
  * @param file The file descriptor to write to.
  * @param buf The buffer to write from. 
  * @param numBytes The number of bytes to write from buf. 
@@ -311,18 +486,24 @@ int _wait(int *status) {
  */
 int _write(int file, const void *buf, size_t numBytes)
 {
-    // TODO: Make it capable of writing to serial out
     switch (file) {
-    case (STDOUT_FILENO): {
-        // TODO: Write to UART
-        return -1;
-    }
+    case (STDOUT_FILENO):
     case (STDERR_FILENO): {
-        // TODO: Write to UART
-        return -1;
+#if defined(TM4C_STDIO_BACKEND_ITM)
+        tm4c_itm_write(TM4C_ITM_PORT_TEXT, buf, numBytes);
+#else
+        tm4c_uart0_write(buf, numBytes);
+#endif
+        return (int)numBytes;
     }
     }
 
+#if TM4C_FS_SIZE > 0
+    if (file >= TM4C_FS_FD_FIRST) {
+        return fs_result(tm4c_fs_write(file, buf, numBytes));
+    }
+#endif
+
     // invalid file descriptor
     errno = EBADF;
     return -1;
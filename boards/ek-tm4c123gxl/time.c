@@ -0,0 +1,163 @@
+/**
+ * @file time.c
+ * @author Esteban Duran (@astroesteban)
+ * @brief The 64-bit time base described in tm4c_time.h.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @ref TM4C123GH6PM datasheet section 11.4 (Initialization and Configuration)
+ *
+ * @copyright Apache License
+ *
+ */
+#include "tm4c_time.h"
+
+// +--------------------------------------------------------------------------+
+// +			        Type Definitions and Macros                           +
+// +--------------------------------------------------------------------------+
+
+/*
+ * The host tests (test/host) build this file against a simulated timer,
+ * every register access goes through tm4c_time_sim_register() there and the
+ * clock gating through tm4c_time_sim_sysctl().
+ */
+#if defined(TM4C_TIME_SIMULATED)
+volatile uint32_t *tm4c_time_sim_register(uint32_t offset);
+volatile uint32_t *tm4c_time_sim_sysctl(uint32_t offset);
+#define WTIMER5_REG(offset) (*tm4c_time_sim_register(offset))
+#define SYSCTL_REG(offset) (*tm4c_time_sim_sysctl(offset))
+#define IRQ_SAVE() 0UL
+#define IRQ_RESTORE(primask) ((void)(primask))
+#else
+#define WTIMER5_REG(offset) (*((volatile uint32_t *)(0x4003F000UL + (offset))))
+#define SYSCTL_REG(offset) (*((volatile uint32_t *)(0x400FE000UL + (offset))))
+
+static inline uint32_t irq_save(void) {
+    uint32_t primask;
+
+    __asm volatile ("mrs %0, primask\n\tcpsid i" : "=r"(primask) :: "memory");
+    return primask;
+}
+
+static inline void irq_restore(uint32_t primask) {
+    __asm volatile ("msr primask, %0" :: "r"(primask) : "memory");
+}
+
+#define IRQ_SAVE() irq_save()
+#define IRQ_RESTORE(primask) irq_restore(primask)
+#endif
+
+#define WTIMER5_CFG     WTIMER5_REG(0x000)  // Configuration
+#define WTIMER5_TAMR    WTIMER5_REG(0x004)  // Timer A Mode
+#define WTIMER5_CTL     WTIMER5_REG(0x00C)  // Control
+#define WTIMER5_TAILR   WTIMER5_REG(0x028)  // Timer A Interval Load (lower half)
+#define WTIMER5_TBILR   WTIMER5_REG(0x02C)  // Timer B Interval Load (upper half)
+#define WTIMER5_TAV     WTIMER5_REG(0x050)  // Timer A Value (lower half)
+#define WTIMER5_TBV     WTIMER5_REG(0x054)  // Timer B Value (upper half)
+
+#define GPTM_CFG_64_BIT     0x0UL           // timers A and B concatenated
+#define GPTM_TAMR_PERIODIC  0x2UL
+#define GPTM_TAMR_TACDIR    (1UL << 4)      // count up
+#define GPTM_CTL_TAEN       (1UL << 0)
+
+#define SYSCTL_RCGCWTIMER   SYSCTL_REG(0x65C)   // Wide Timer Run Mode Clock Gating
+#define SYSCTL_PRWTIMER     SYSCTL_REG(0xA5C)   // Wide Timer Peripheral Ready
+#define SYSCTL_WTIMER5      (1UL << 5)
+
+#define NS_PER_SECOND       1000000000ULL
+
+
+// +--------------------------------------------------------------------------+
+// +					Global Variables definition	    				      +
+// +--------------------------------------------------------------------------+
+
+/*
+ * CLOCK_REALTIME - CLOCK_MONOTONIC in nanoseconds. The writer runs with the
+ * interrupts off and makes the sequence odd while it updates the offset, a
+ * reader that saw an odd or changed sequence reads again.
+ */
+static volatile uint32_t realtime_sequence;
+static volatile int64_t realtime_offset_ns;
+
+
+// +--------------------------------------------------------------------------+
+// +                          Function Definitions                            +
+// +--------------------------------------------------------------------------+
+void tm4c_time_init(void) {
+    // the timer's registers fault while its clock is gated, so only look at
+    // them once the clock is known to run
+    if ((SYSCTL_RCGCWTIMER & SYSCTL_WTIMER5) != 0 && (WTIMER5_CTL & GPTM_CTL_TAEN) != 0) {
+        return;
+    }
+
+    SYSCTL_RCGCWTIMER = SYSCTL_RCGCWTIMER | SYSCTL_WTIMER5;
+    while ((SYSCTL_PRWTIMER & SYSCTL_WTIMER5) == 0);
+
+    WTIMER5_CFG = GPTM_CFG_64_BIT;
+    WTIMER5_TAMR = GPTM_TAMR_PERIODIC | GPTM_TAMR_TACDIR;
+    WTIMER5_TAILR = 0xFFFFFFFFUL;
+    WTIMER5_TBILR = 0xFFFFFFFFUL;
+    WTIMER5_CTL = GPTM_CTL_TAEN;
+}
+
+uint64_t tm4c_time_ticks(void) {
+    uint32_t high = WTIMER5_TBV;
+    uint32_t low = WTIMER5_TAV;
+    const uint32_t check = WTIMER5_TBV;
+
+    // the lower half wrapped between the two reads of the upper half, the
+    // new upper half goes with a lower half read after the wrap
+    if (check != high) {
+        high = check;
+        low = WTIMER5_TAV;
+    }
+
+    return ((uint64_t)high << 32) | low;
+}
+
+/**
+ * @brief Converts ticks without overflowing for the lifetime of the counter.
+ */
+static uint64_t ticks_to_ns(uint64_t ticks) {
+    return (ticks / TM4C_TIME_HZ) * NS_PER_SECOND +
+           (ticks % TM4C_TIME_HZ) * NS_PER_SECOND / TM4C_TIME_HZ;
+}
+
+uint64_t tm4c_time_ns(void) {
+    return ticks_to_ns(tm4c_time_ticks());
+}
+
+void tm4c_time_set_realtime(const struct timespec *now) {
+    const int64_t realtime_ns = (int64_t)now->tv_sec * (int64_t)NS_PER_SECOND + now->tv_nsec;
+    const uint32_t primask = IRQ_SAVE();
+
+    realtime_sequence = realtime_sequence + 1;
+    realtime_offset_ns = realtime_ns - (int64_t)tm4c_time_ns();
+    realtime_sequence = realtime_sequence + 1;
+
+    IRQ_RESTORE(primask);
+}
+
+int tm4c_time_get(clockid_t clock_id, struct timespec *tp) {
+    uint64_t ns;
+
+    if (clock_id == CLOCK_MONOTONIC) {
+        ns = tm4c_time_ns();
+    } else if (clock_id == CLOCK_REALTIME) {
+        uint32_t sequence;
+        int64_t offset;
+
+        do {
+            sequence = realtime_sequence;
+            offset = realtime_offset_ns;
+        } while ((sequence & 1) != 0 || sequence != realtime_sequence);
+
+        ns = tm4c_time_ns() + (uint64_t)offset;
+    } else {
+        return -1;
+    }
+
+    tp->tv_sec = (time_t)(ns / NS_PER_SECOND);
+    tp->tv_nsec = (long)(ns % NS_PER_SECOND);
+    return 0;
+}
@@ -0,0 +1,619 @@
+/**
+ * @file uart.c
+ * @author Esteban Duran (@astroesteban)
+ * @brief Interrupt and uDMA driven UART0 transmitter and interrupt-driven
+ *        receiver described in tm4c_uart.h.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @ref TM4C123GH6PM datasheet section 14.4 (Initialization and Configuration)
+ *
+ * @copyright Apache License
+ *
+ */
+#include "tm4c_uart.h"
+
+#include <assert.h>
+#include <string.h>
+
+#include "tm4c_clock.h"
+#include "tm4c_gpio.h"
+#include "tm4c_interrupts.h"
+#include "tm4c_ring.h"
+#include "tm4c_udma.h"
+
+// +--------------------------------------------------------------------------+
+// +			        Type Definitions and Macros                           +
+// +--------------------------------------------------------------------------+
+
+/*
+ * The host tests (test/host) build this file against a simulated register
+ * block, every register access goes through tm4c_uart_sim_register() there.
+ */
+#if defined(TM4C_UART_SIMULATED)
+volatile uint32_t *tm4c_uart_sim_register(uint32_t offset);
+#define UART0_REG(offset) (*tm4c_uart_sim_register(offset))
+#else
+#define UART0_REG(offset) (*((volatile uint32_t *)(0x4000C000UL + (offset))))
+#endif
+
+#define UART0_DR        UART0_REG(0x000)    // Data
+#define UART0_FR        UART0_REG(0x018)    // Flag
+#define UART0_IBRD      UART0_REG(0x024)    // Integer Baud-Rate Divisor
+#define UART0_FBRD      UART0_REG(0x028)    // Fractional Baud-Rate Divisor
+#define UART0_LCRH      UART0_REG(0x02C)    // Line Control
+#define UART0_CTL       UART0_REG(0x030)    // Control
+#define UART0_IFLS      UART0_REG(0x034)    // Interrupt FIFO Level Select
+#define UART0_IM        UART0_REG(0x038)    // Interrupt Mask
+#define UART0_MIS       UART0_REG(0x040)    // Masked Interrupt Status
+#define UART0_ICR       UART0_REG(0x044)    // Interrupt Clear
+#define UART0_DMACTL    UART0_REG(0x048)    // DMA Control
+#define UART0_CC        UART0_REG(0xFC8)    // Clock Configuration
+
+#define UART0_DR_ADDRESS    0x4000C000UL
+
+#define UART_DR_ERRORS      (0x7UL << 8)    // framing, parity and break errors
+#define UART_DR_OE          (1UL << 11)     // the RX FIFO overflowed before this byte
+#define UART_FR_BUSY        (1UL << 3)      // still transmitting
+#define UART_FR_RXFE        (1UL << 4)      // RX FIFO empty
+#define UART_FR_TXFF        (1UL << 5)      // TX FIFO full
+#define UART_LCRH_FEN       (1UL << 4)      // enable the FIFOs
+#define UART_LCRH_WLEN_8    (0x3UL << 5)    // 8 data bits
+#define UART_CTL_UARTEN     (1UL << 0)
+#define UART_CTL_TXE        (1UL << 8)
+#define UART_CTL_RXE        (1UL << 9)
+#define UART_IFLS_TX_HALF   (0x2UL << 0)    // TX interrupt at <= 8 bytes in the FIFO
+#define UART_IFLS_RX_HALF   (0x2UL << 3)    // RX interrupt at >= 8 bytes in the FIFO
+#define UART_INT_RX         (1UL << 4)
+#define UART_INT_TX         (1UL << 5)
+#define UART_INT_RT         (1UL << 6)      // receive timeout, bytes sit in the FIFO
+#define UART_DMACTL_TXDMAE  (1UL << 1)
+#define UART_CC_SYSCLK      0x0UL
+
+#define SYSCTL_RCGCGPIO (*((volatile uint32_t *)0x400FE608)) // GPIO Run Mode Clock Gating
+#define SYSCTL_RCGCUART (*((volatile uint32_t *)0x400FE618)) // UART Run Mode Clock Gating
+#define SYSCTL_PRGPIO   (*((volatile uint32_t *)0x400FEA08)) // GPIO Peripheral Ready
+#define SYSCTL_PRUART   (*((volatile uint32_t *)0x400FEA18)) // UART Peripheral Ready
+
+#define GPIOA_REG(offset) (*((volatile uint32_t *)(TM4C_GPIO_BASE(0U) + (offset))))
+#define GPIOA_AFSEL     GPIOA_REG(0x420)    // Alternate Function Select
+#define GPIOA_DEN       GPIOA_REG(0x51C)    // Digital Enable
+#define GPIOA_AMSEL     GPIOA_REG(0x528)    // Analog Mode Select
+#define GPIOA_PCTL      GPIOA_REG(0x52C)    // Port Control
+
+#define UART0_PINS      0x03UL              // PA0 = U0RX, PA1 = U0TX
+#define UART0_PCTL_M    0xFFUL
+#define UART0_PCTL      0x11UL              // PMC0 = PMC1 = 1 (UART)
+
+/* BRD = clk / (16 * baud), FBRD holds the fraction in 1/64ths */
+#define UART0_BRD_X64 \
+    (((unsigned long long)TM4C_SYSCLK_HZ * 4ULL + TM4C_STDIO_BAUD / 2) / TM4C_STDIO_BAUD)
+
+static_assert(TM4C_IS_POWER_OF_TWO(TM4C_STDIO_TX_BUFFER),
+              "TM4C_STDIO_TX_BUFFER must be a power of two");
+static_assert(TM4C_IS_POWER_OF_TWO(TM4C_STDIO_RX_BUFFER),
+              "TM4C_STDIO_RX_BUFFER must be a power of two");
+static_assert((UART0_BRD_X64 >> 6) >= 1 && (UART0_BRD_X64 >> 6) <= 0xFFFF,
+              "TM4C_STDIO_BAUD is out of range for the system clock");
+
+#define ASCII_BS    0x08
+#define ASCII_DEL   0x7F
+
+/*
+ * The receiver sleeps until the next interrupt, the simulation cannot. The
+ * ring is checked once more with PRIMASK set: bytes the interrupt queued
+ * after the reader last looked skip the sleep, and an interrupt arriving
+ * later still ends the wfi because a pending interrupt wakes the core even
+ * while PRIMASK holds it off. It runs once PRIMASK is restored.
+ */
+#if defined(TM4C_UART_SIMULATED)
+#define UART0_WAIT()
+#else
+#define UART0_WAIT() rx_wait()
+#endif
+
+/*
+ * The writer acts as the consumer of the ring now and then. The interrupt
+ * (FIFO refills and DMA completions alike) is kept out meanwhile. The host
+ * simulation never interrupts anything.
+ */
+#if defined(TM4C_UART_SIMULATED)
+#define UART0_IRQ_OFF()
+#define UART0_IRQ_ON()
+#else
+#define UART0_IRQ_OFF() tm4c_irq_disable(TM4C_IRQ_UART0)
+#define UART0_IRQ_ON()  tm4c_irq_enable(TM4C_IRQ_UART0)
+#endif
+
+#if TM4C_STDIO_DMA_THRESHOLD > 0
+#define UART0_TX_DMA 1
+#else
+#define UART0_TX_DMA 0
+#endif
+
+/* Bytes from memory into DR, in bursts of the 8 bytes the FIFO trigger frees */
+#define UART0_TX_DMA_CONTROL                                                  \
+    (TM4C_UDMA_DST_INC_NONE | TM4C_UDMA_DST_SIZE_8 | TM4C_UDMA_SRC_INC_8 |  \
+     TM4C_UDMA_SRC_SIZE_8 | TM4C_UDMA_ARB(3) | TM4C_UDMA_MODE_BASIC)
+
+#if defined(TM4C_STDIO_TX_POLICY_DROP_NEWEST)
+#define UART0_DEFAULT_POLICY TM4C_UART_DROP_NEWEST
+#elif defined(TM4C_STDIO_TX_POLICY_DROP_OLDEST)
+#define UART0_DEFAULT_POLICY TM4C_UART_DROP_OLDEST
+#else
+#define UART0_DEFAULT_POLICY TM4C_UART_BLOCK
+#endif
+
+
+// +--------------------------------------------------------------------------+
+// +					Global Variables definition	    				      +
+// +--------------------------------------------------------------------------+
+static uint8_t tx_storage[TM4C_STDIO_TX_BUFFER];
+static tm4c_ring_t tx = TM4C_RING_INIT(tx_storage);
+
+static tm4c_uart_policy_t policy = UART0_DEFAULT_POLICY;
+static uint32_t dropped;
+static int initialized;
+
+/* Filled by the interrupt, emptied by the readers */
+static uint8_t rx_storage[TM4C_STDIO_RX_BUFFER];
+static tm4c_ring_t rx = TM4C_RING_INIT(rx_storage);
+static volatile uint32_t rx_lost;
+
+/* The line being edited in cooked mode */
+static tm4c_uart_mode_t mode = TM4C_UART_COOKED;
+static uint8_t line[TM4C_STDIO_LINE_MAX];
+static uint32_t line_length;
+static uint32_t line_position;      // next byte a reader gets
+static int line_done;               // the line is complete and can be read
+static int skip_lf;                 // the line ended with CR, ignore an LF
+
+#if UART0_TX_DMA
+/* Who the running DMA transfer reads from */
+static enum { DMA_IDLE, DMA_RING, DMA_USER } dma_state;
+static uint32_t dma_count;
+
+/* The tm4c_uart0_write_async() request, streamed in place */
+static struct {
+    const uint8_t *data;
+    size_t size;                // bytes left, 0 when there is no request
+    uint32_t after;             // ring position that has to go out first
+    tm4c_uart_done_t done;
+    void *context;
+} async;
+#endif
+
+
+// +--------------------------------------------------------------------------+
+// +                          Function Definitions                            +
+// +--------------------------------------------------------------------------+
+
+/**
+ * @brief Moves bytes from the ring into the FIFO until either runs out or
+ *        the ring position limit is reached.
+ */
+static void tx_drain(uint32_t limit) {
+    uint8_t byte;
+
+    while (tx.tail != limit && (UART0_FR & UART_FR_TXFF) == 0 && tm4c_ring_get(&tx, &byte)) {
+        UART0_DR = byte;
+    }
+#if UART0_TX_DMA
+    UART0_IM = UART0_IM | UART_INT_TX;
+#endif
+}
+
+#if UART0_TX_DMA
+static void dma_begin(int state, const uint8_t *source, uint32_t count) {
+    // the DMA requests keep the FIFO topped up, no need for its interrupt
+    UART0_IM = UART0_IM & ~UART_INT_TX;
+    dma_state = state;
+    dma_count = count;
+    tm4c_udma_start(TM4C_UDMA_CH_UART0_TX, source, (volatile void *)UART0_DR_ADDRESS,
+                    UART0_TX_DMA_CONTROL | TM4C_UDMA_XFER_SIZE(count));
+}
+
+/**
+ * @brief Accounts for a transfer that has ended after sent bytes.
+ */
+static void dma_finish(uint32_t sent) {
+    const int state = dma_state;
+
+    dma_state = DMA_IDLE;
+
+    if (state == DMA_RING) {
+        tm4c_ring_skip(&tx, sent);
+        return;
+    }
+
+    async.data += sent;
+    async.size -= sent;
+    if (async.size == 0 && async.done != 0) {
+        // the callback may queue the next request
+        const tm4c_uart_done_t done = async.done;
+        async.done = 0;
+        done(async.context);
+    }
+}
+#endif
+
+/**
+ * @brief The consumer of the ring: hands the next bytes to the DMA or to the
+ *        FIFO. Only runs in the interrupt handler or with the interrupt
+ *        masked.
+ */
+static void tx_service(void) {
+#if UART0_TX_DMA
+    if (dma_state != DMA_IDLE) {
+        if (tm4c_udma_busy(TM4C_UDMA_CH_UART0_TX)) {
+            return;
+        }
+        dma_finish(dma_count);
+        if (dma_state != DMA_IDLE) {
+            return;
+        }
+    }
+
+    // what was queued before the async request goes out first
+    uint32_t limit = tx.head;
+    if (async.size > 0) {
+        if ((int32_t)(async.after - tx.tail) <= 0) {
+            const uint32_t count = async.size < TM4C_UDMA_MAX_TRANSFER
+                ? (uint32_t)async.size : TM4C_UDMA_MAX_TRANSFER;
+            dma_begin(DMA_USER, async.data, count);
+            return;
+        }
+        limit = async.after;
+    }
+
+    // bulk goes straight from the ring, small writes through the FIFO
+    if (limit - tx.tail >= TM4C_STDIO_DMA_THRESHOLD) {
+        const uint8_t *span;
+        uint32_t count = tm4c_ring_span(&tx, &span);
+
+        count = count < limit - tx.tail ? count : limit - tx.tail;
+        count = count < TM4C_UDMA_MAX_TRANSFER ? count : TM4C_UDMA_MAX_TRANSFER;
+        dma_begin(DMA_RING, span, count);
+        return;
+    }
+
+    tx_drain(limit);
+#else
+    tx_drain(tx.head);
+#endif
+}
+
+/**
+ * @brief Runs the consumer from the writer's side. The interrupt only fires
+ *        when the FIFO drains past its trigger level or a transfer completes,
+ *        so an idle transmitter has to be started by the writer.
+ */
+static void tx_kick(void) {
+    UART0_IRQ_OFF();
+    tx_service();
+    UART0_IRQ_ON();
+}
+
+/**
+ * @brief Empties the RX FIFO into the ring. Runs in the interrupt, which the
+ *        FIFO raises once it is half full or when bytes sit in it for 32 bit
+ *        periods, so bytes arrive in batches.
+ */
+static void rx_service(void) {
+    while ((UART0_FR & UART_FR_RXFE) == 0) {
+        const uint32_t data = UART0_DR;
+
+        if (data & UART_DR_OE) {
+            rx_lost = rx_lost + 1;
+        }
+        if ((data & UART_DR_ERRORS) || !tm4c_ring_put(&rx, (uint8_t)data)) {
+            rx_lost = rx_lost + 1;
+        }
+    }
+}
+
+/**
+ * @brief Echoes what the line editor did. Runs in readers that must not
+ *        block, so whatever the policy, bytes that do not fit the TX ring
+ *        are dropped and counted instead of waiting for the transmitter.
+ */
+static void echo(const char *text, size_t size) {
+    const uint32_t written = tm4c_ring_write(&tx, text, (uint32_t)size);
+
+    dropped += (uint32_t)size - written;
+    tx_kick();
+}
+
+/**
+ * @brief The line discipline of cooked mode: moves received bytes into the
+ *        line until it is complete. Runs in the reader.
+ */
+static void cook(void) {
+    uint8_t byte;
+
+    while (!line_done && tm4c_ring_get(&rx, &byte)) {
+        if (byte == '\n' && skip_lf) {
+            skip_lf = 0;
+            continue;
+        }
+        skip_lf = byte == '\r';
+
+        if (byte == '\r' || byte == '\n') {
+            line[line_length++] = '\n';
+            line_done = 1;
+            echo("\r\n", 2);
+        } else if (byte == ASCII_BS || byte == ASCII_DEL) {
+            if (line_length > 0) {
+                line_length--;
+                echo("\b \b", 3);
+            }
+        } else if (line_length < sizeof(line) - 1) {
+            // keep the last byte for the newline
+            line[line_length++] = byte;
+            echo((const char *)&byte, 1);
+        } else {
+            echo("\a", 1);
+        }
+    }
+}
+
+#if !defined(TM4C_UART_SIMULATED)
+static void uart0_board_init(void) {
+    SYSCTL_RCGCUART = SYSCTL_RCGCUART | (1UL << 0);
+    SYSCTL_RCGCGPIO = SYSCTL_RCGCGPIO | (1UL << 0);
+    while ((SYSCTL_PRUART & (1UL << 0)) == 0);
+    while ((SYSCTL_PRGPIO & (1UL << 0)) == 0);
+
+    GPIOA_AMSEL = GPIOA_AMSEL & ~UART0_PINS;
+    GPIOA_AFSEL = GPIOA_AFSEL | UART0_PINS;
+    GPIOA_PCTL = (GPIOA_PCTL & ~UART0_PCTL_M) | UART0_PCTL;
+    GPIOA_DEN = GPIOA_DEN | UART0_PINS;
+}
+#endif
+
+void tm4c_uart0_init(void) {
+    if (initialized) {
+        return;
+    }
+
+#if !defined(TM4C_UART_SIMULATED)
+    uart0_board_init();
+#endif
+
+    UART0_CTL = 0;
+    UART0_IBRD = (uint32_t)(UART0_BRD_X64 >> 6);
+    UART0_FBRD = (uint32_t)(UART0_BRD_X64 & 0x3F);
+    UART0_LCRH = UART_LCRH_WLEN_8 | UART_LCRH_FEN;
+    UART0_CC = UART_CC_SYSCLK;
+    UART0_IFLS = UART_IFLS_TX_HALF | UART_IFLS_RX_HALF;
+    UART0_IM = UART_INT_TX | UART_INT_RX | UART_INT_RT;
+    UART0_CTL = UART_CTL_UARTEN | UART_CTL_TXE | UART_CTL_RXE;
+
+#if UART0_TX_DMA
+    tm4c_udma_init();
+    tm4c_udma_assign(TM4C_UDMA_CH_UART0_TX, 0);
+    UART0_DMACTL = UART_DMACTL_TXDMAE;
+#endif
+
+#if !defined(TM4C_UART_SIMULATED)
+    tm4c_irq_enable(TM4C_IRQ_UART0);
+#endif
+
+    initialized = 1;
+}
+
+size_t tm4c_uart0_write(const void *data, size_t size) {
+    const uint8_t *bytes = data;
+    size_t left = size;
+
+    tm4c_uart0_init();
+
+    while (left > 0) {
+        const uint32_t chunk = left < tm4c_ring_size(&tx) ? (uint32_t)left : tm4c_ring_size(&tx);
+        const uint32_t written = tm4c_ring_write(&tx, bytes, chunk);
+
+        bytes += written;
+        left -= written;
+
+        if (left == 0) {
+            break;
+        }
+
+        if (policy == TM4C_UART_DROP_NEWEST) {
+            dropped += (uint32_t)left;
+            size -= left;
+            break;
+        }
+
+        if (policy == TM4C_UART_DROP_OLDEST) {
+            // only the newest bytes that fit the ring can survive
+            if (left > tm4c_ring_size(&tx)) {
+                dropped += (uint32_t)(left - tm4c_ring_size(&tx));
+                bytes += left - tm4c_ring_size(&tx);
+                left = tm4c_ring_size(&tx);
+            }
+
+            // we become the consumer for a moment, keep the interrupt out
+            UART0_IRQ_OFF();
+#if UART0_TX_DMA
+            // the bytes a transfer streams from the ring cannot be dropped
+            // while it runs, stop it where it is
+            if (dma_state == DMA_RING) {
+                const uint32_t unsent = tm4c_udma_stop(TM4C_UDMA_CH_UART0_TX);
+                tm4c_udma_done(TM4C_UDMA_CH_UART0_TX);
+                dma_finish(dma_count - unsent);
+            }
+#endif
+            const uint32_t free = tm4c_ring_free(&tx);
+            if (left > free) {
+                tm4c_ring_skip(&tx, (uint32_t)left - free);
+                dropped += (uint32_t)left - free;
+            }
+            UART0_IRQ_ON();
+            continue;
+        }
+
+        // TM4C_UART_BLOCK, feed the FIFO ourselves so we make progress even
+        // when interrupts are disabled
+        tx_kick();
+    }
+
+    tx_kick();
+    return size;
+}
+
+int tm4c_uart0_write_async(const void *data, size_t size, tm4c_uart_done_t done,
+                           void *context) {
+#if UART0_TX_DMA
+    tm4c_uart0_init();
+
+    UART0_IRQ_OFF();
+    if (async.size > 0) {
+        UART0_IRQ_ON();
+        return -1;
+    }
+
+    if (size > 0) {
+        async.data = data;
+        async.after = tx.head;
+        async.done = done;
+        async.context = context;
+        async.size = size;
+        tx_service();
+        UART0_IRQ_ON();
+        return 0;
+    }
+    UART0_IRQ_ON();
+#else
+    tm4c_uart0_write(data, size);
+#endif
+
+    if (done != 0) {
+        done(context);
+    }
+    return 0;
+}
+
+/**
+ * @brief Whether anything is still queued in software.
+ */
+static int tx_pending(void) {
+#if UART0_TX_DMA
+    if (async.size > 0 || dma_state != DMA_IDLE) {
+        return 1;
+    }
+#endif
+    return tm4c_ring_used(&tx) > 0;
+}
+
+void tm4c_uart0_flush(void) {
+    if (!initialized) {
+        return;
+    }
+
+    while (tx_pending() || (UART0_FR & UART_FR_BUSY)) {
+        tx_kick();
+    }
+}
+
+void tm4c_uart0_set_policy(tm4c_uart_policy_t new_policy) {
+    policy = new_policy;
+}
+
+uint32_t tm4c_uart0_dropped(void) {
+    return dropped;
+}
+
+void tm4c_uart0_set_mode(tm4c_uart_mode_t new_mode) {
+    mode = new_mode;
+    line_length = 0;
+    line_position = 0;
+    line_done = 0;
+    skip_lf = 0;
+}
+
+size_t tm4c_uart0_available(void) {
+    tm4c_uart0_init();
+
+    if (mode == TM4C_UART_RAW) {
+        return tm4c_ring_used(&rx);
+    }
+
+    cook();
+    return line_done ? line_length - line_position : 0;
+}
+
+size_t tm4c_uart0_read_some(void *data, size_t size) {
+    tm4c_uart0_init();
+
+    if (mode == TM4C_UART_RAW) {
+        return tm4c_ring_read(&rx, data, size < UINT32_MAX ? (uint32_t)size : UINT32_MAX);
+    }
+
+    cook();
+    if (!line_done) {
+        return 0;
+    }
+
+    const uint32_t left = line_length - line_position;
+    const uint32_t count = size < left ? (uint32_t)size : left;
+
+    memcpy(data, &line[line_position], count);
+    line_position += count;
+
+    if (line_position == line_length) {
+        line_length = 0;
+        line_position = 0;
+        line_done = 0;
+    }
+    return count;
+}
+
+#if !defined(TM4C_UART_SIMULATED)
+static void rx_wait(void) {
+    uint32_t primask;
+
+    __asm volatile ("mrs %0, primask\n\tcpsid i" : "=r"(primask) :: "memory");
+    if (tm4c_ring_used(&rx) == 0) {
+        __asm volatile ("wfi" ::: "memory");
+    }
+    __asm volatile ("msr primask, %0" :: "r"(primask) : "memory");
+}
+#endif
+
+size_t tm4c_uart0_read(void *data, size_t size) {
+    size_t count;
+
+    if (size == 0) {
+        return 0;
+    }
+
+    while ((count = tm4c_uart0_read_some(data, size)) == 0) {
+        UART0_WAIT();
+    }
+    return count;
+}
+
+uint32_t tm4c_uart0_rx_lost(void) {
+    return rx_lost;
+}
+
+void UART0_ISR(void) {
+    const uint32_t status = UART0_MIS;
+
+    UART0_ICR = status;
+
+    if (status & (UART_INT_RX | UART_INT_RT)) {
+        rx_service();
+    }
+
+#if UART0_TX_DMA
+    if (tm4c_udma_done(TM4C_UDMA_CH_UART0_TX) || (status & UART_INT_TX)) {
+        tx_service();
+    }
+#else
+    if (status & UART_INT_TX) {
+        tx_service();
+    }
+#endif
+}
@@ -0,0 +1,142 @@
+/**
+ * @file udma.c
+ * @author Esteban Duran (@astroesteban)
+ * @brief The micro DMA driver described in tm4c_udma.h.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @ref TM4C123GH6PM datasheet section 9.3 (Initialization and Configuration)
+ *
+ * @copyright Apache License
+ *
+ */
+#include "tm4c_udma.h"
+
+#include <assert.h>
+
+// +--------------------------------------------------------------------------+
+// +			        Type Definitions and Macros                           +
+// +--------------------------------------------------------------------------+
+
+/*
+ * The host tests (test/host) build this file against a simulated controller,
+ * every register access goes through tm4c_udma_sim_register() there.
+ */
+#if defined(TM4C_UDMA_SIMULATED)
+volatile uint32_t *tm4c_udma_sim_register(uint32_t offset);
+#define UDMA_REG(offset) (*tm4c_udma_sim_register(offset))
+#else
+#define UDMA_REG(offset) (*((volatile uint32_t *)(0x400FF000UL + (offset))))
+#endif
+
+#define UDMA_CFG            UDMA_REG(0x004) // Configuration
+#define UDMA_CTLBASE        UDMA_REG(0x008) // Channel Control Base Pointer
+#define UDMA_USEBURSTCLR    UDMA_REG(0x01C) // Channel Useburst Clear
+#define UDMA_REQMASKCLR     UDMA_REG(0x024) // Channel Request Mask Clear
+#define UDMA_ENASET         UDMA_REG(0x028) // Channel Enable Set
+#define UDMA_ENACLR         UDMA_REG(0x02C) // Channel Enable Clear
+#define UDMA_ALTCLR         UDMA_REG(0x034) // Channel Primary Alternate Clear
+#define UDMA_CHIS           UDMA_REG(0x504) // Channel Interrupt Status
+#define UDMA_CHMAP(n)       UDMA_REG(0x510 + 4 * (n)) // Channel Map Select n
+
+#define UDMA_CFG_MASTEN     (1UL << 0)
+
+#define SYSCTL_RCGCDMA  (*((volatile uint32_t *)0x400FE60C)) // uDMA Run Mode Clock Gating
+#define SYSCTL_PRDMA    (*((volatile uint32_t *)0x400FEA0C)) // uDMA Peripheral Ready
+
+#define CONTROL_INC(control, shift) (((control) >> (shift)) & 0x3UL)
+#define INC_NONE                    0x3UL
+
+#if UINTPTR_MAX == 0xFFFFFFFFUL
+static_assert(sizeof(tm4c_udma_control_t) == 16,
+              "The control structure layout is fixed by the hardware");
+static_assert(sizeof(tm4c_udma_table) == 1024,
+              "The alternate structures start 0x200 bytes into the table");
+#endif
+
+
+// +--------------------------------------------------------------------------+
+// +					Global Variables definition	    				      +
+// +--------------------------------------------------------------------------+
+__attribute__((aligned(1024)))
+volatile tm4c_udma_control_t tm4c_udma_table[TM4C_UDMA_TABLE_ENTRIES];
+
+static int initialized;
+
+
+// +--------------------------------------------------------------------------+
+// +                          Function Definitions                            +
+// +--------------------------------------------------------------------------+
+
+/**
+ * @brief Address of the last item of a transfer, the controller wants the
+ *        end pointers.
+ */
+static uintptr_t end_address(uintptr_t start, uint32_t increment, uint32_t items) {
+    return increment == INC_NONE ? start : start + ((uintptr_t)(items - 1) << increment);
+}
+
+void tm4c_udma_init(void) {
+    if (initialized) {
+        return;
+    }
+
+#if !defined(TM4C_UDMA_SIMULATED)
+    SYSCTL_RCGCDMA = SYSCTL_RCGCDMA | (1UL << 0);
+    while ((SYSCTL_PRDMA & (1UL << 0)) == 0);
+#endif
+
+    UDMA_CFG = UDMA_CFG_MASTEN;
+    UDMA_CTLBASE = (uint32_t)(uintptr_t)tm4c_udma_table;
+    initialized = 1;
+}
+
+void tm4c_udma_assign(uint32_t channel, uint32_t encoding) {
+    const uint32_t shift = (channel % 8) * 4;
+
+    UDMA_CHMAP(channel / 8) = (UDMA_CHMAP(channel / 8) & ~(0xFUL << shift)) | (encoding << shift);
+}
+
+void tm4c_udma_start(uint32_t channel, const volatile void *source,
+                     volatile void *destination, uint32_t control) {
+    volatile tm4c_udma_control_t *const entry = &tm4c_udma_table[channel];
+    const uint32_t items = ((control >> 4) & 0x3FFUL) + 1;
+
+    entry->source_end = (const volatile void *)end_address(
+        (uintptr_t)source, CONTROL_INC(control, 26), items);
+    entry->destination_end = (volatile void *)end_address(
+        (uintptr_t)destination, CONTROL_INC(control, 30), items);
+    entry->control = control;
+
+    // primary structure, single and burst requests, then go
+    UDMA_ALTCLR = 1UL << channel;
+    UDMA_USEBURSTCLR = 1UL << channel;
+    UDMA_REQMASKCLR = 1UL << channel;
+    __asm volatile ("" ::: "memory");
+    UDMA_ENASET = 1UL << channel;
+}
+
+int tm4c_udma_busy(uint32_t channel) {
+    return (UDMA_ENASET & (1UL << channel)) != 0;
+}
+
+int tm4c_udma_done(uint32_t channel) {
+    if ((UDMA_CHIS & (1UL << channel)) == 0) {
+        return 0;
+    }
+
+    UDMA_CHIS = 1UL << channel;
+    return 1;
+}
+
+uint32_t tm4c_udma_stop(uint32_t channel) {
+    UDMA_ENACLR = 1UL << channel;
+
+    const uint32_t control = tm4c_udma_table[channel].control;
+
+    // the controller sets the mode to stop once the last item is through
+    if ((control & 0x7UL) == TM4C_UDMA_MODE_STOP) {
+        return 0;
+    }
+    return ((control >> 4) & 0x3FFUL) + 1;
+}
@@ -0,0 +1,159 @@
+###
+# Build-time configuration of the board support library. Each option is
+# forwarded to the `tm4c` target as a compile definition in
+# boards/ek-tm4c123gxl/CMakeLists.txt.
+###
+
+# How the FPU state is saved on exception entry.
+#   LAZY   -- space for S0-S15/FPSCR is reserved on the stack but the registers
+#             are only pushed if the ISR actually touches the FPU (default).
+#   ALWAYS -- the FPU state is pushed on every exception entry, which gives a
+#             deterministic but longer ISR entry latency.
+#   OFF    -- no automatic FPU state preservation. Fastest ISR entry but ISRs
+#             must never execute a floating point instruction.
+set(TM4C_FPU_CONTEXT
+  "LAZY"
+  CACHE STRING "FPU context saving on exception entry")
+set(TM4C_FPU_CONTEXT_VALUES "LAZY" "ALWAYS" "OFF")
+set_property(CACHE TM4C_FPU_CONTEXT PROPERTY STRINGS ${TM4C_FPU_CONTEXT_VALUES})
+
+if(NOT TM4C_FPU_CONTEXT IN_LIST TM4C_FPU_CONTEXT_VALUES)
+  message(FATAL_ERROR "TM4C_FPU_CONTEXT must be one of ${TM4C_FPU_CONTEXT_VALUES}")
+endif()
+
+# The clock tree Reset_Handler configures before main(). Invalid combinations
+# are rejected at compile time by boards/ek-tm4c123gxl/include/tm4c_clock.h.
+set(TM4C_CLOCK_SOURCE
+  "MOSC"
+  CACHE STRING "Oscillator feeding the PLL / system clock (MOSC or PIOSC)")
+set(TM4C_CLOCK_SOURCE_VALUES "MOSC" "PIOSC")
+set_property(CACHE TM4C_CLOCK_SOURCE PROPERTY STRINGS ${TM4C_CLOCK_SOURCE_VALUES})
+
+if(NOT TM4C_CLOCK_SOURCE IN_LIST TM4C_CLOCK_SOURCE_VALUES)
+  message(FATAL_ERROR "TM4C_CLOCK_SOURCE must be one of ${TM4C_CLOCK_SOURCE_VALUES}")
+endif()
+
+set(TM4C_XTAL_HZ 16000000 CACHE STRING "Frequency of the main oscillator crystal in Hz")
+option(TM4C_CLOCK_USE_PLL "Run the system clock from the 400 MHz PLL" ON)
+set(TM4C_SYSCLK_HZ 80000000 CACHE STRING "Target system clock frequency in Hz")
+
+# Copy the vector table into SRAM at boot and point VTOR at it. Enables
+# attaching interrupt handlers at runtime (tm4c_irq_attach / tm4c::attach).
+option(TM4C_RAM_VECTORS "Relocate the vector table to SRAM" OFF)
+
+# Size of the heap behind malloc/new and of the stack area below the initial
+# stack pointer the heap may never grow into. A heap size of 0 gives the heap
+# every byte of SRAM that is left. The linker fails if both do not fit.
+set(TM4C_HEAP_SIZE 4096 CACHE STRING "Size of the heap in bytes (0 = all remaining SRAM)")
+set(TM4C_MIN_STACK_SIZE 2048 CACHE STRING "Minimum size of the stack in bytes")
+
+# UART0 behind stdout/stderr. Writes are queued in a TX ring of
+# TM4C_STDIO_TX_BUFFER bytes (a power of two) drained by the UART interrupt.
+# What happens when the ring is full:
+#   BLOCK       -- wait until there is space, nothing is lost (default).
+#   DROP_NEWEST -- discard what does not fit, the write returns immediately.
+#   DROP_OLDEST -- discard the oldest queued output to make space.
+# Dropped bytes are counted, see tm4c_uart0_dropped().
+set(TM4C_STDIO_BAUD 115200 CACHE STRING "Baud rate of UART0 (stdout/stderr)")
+set(TM4C_STDIO_TX_BUFFER 512 CACHE STRING "Size of the UART0 TX ring in bytes")
+set(TM4C_STDIO_RX_BUFFER 256 CACHE STRING "Size of the UART0 RX ring in bytes (stdin)")
+set(TM4C_STDIO_TX_POLICY
+  "BLOCK"
+  CACHE STRING "What writes do when the UART0 TX ring is full")
+set(TM4C_STDIO_TX_POLICY_VALUES "BLOCK" "DROP_NEWEST" "DROP_OLDEST")
+set_property(CACHE TM4C_STDIO_TX_POLICY PROPERTY STRINGS ${TM4C_STDIO_TX_POLICY_VALUES})
+
+if(NOT TM4C_STDIO_TX_POLICY IN_LIST TM4C_STDIO_TX_POLICY_VALUES)
+  message(FATAL_ERROR "TM4C_STDIO_TX_POLICY must be one of ${TM4C_STDIO_TX_POLICY_VALUES}")
+endif()
+
+# Hand bulk output to the uDMA: whenever at least this many bytes are queued
+# for UART0 they are streamed from the ring by the DMA (one interrupt per
+# transfer of up to 1 KB). Also makes tm4c_uart0_write_async() zero-copy.
+# 0 leaves the uDMA alone.
+set(TM4C_STDIO_DMA_THRESHOLD 0 CACHE STRING "Queued UART0 bytes that start a uDMA transfer (0 = off)")
+
+# Deferred binary log (TM4C_LOG in tm4c_log.h): size of the ring in .persistent
+# SRAM that records are written to, a power of two. Decode the records with
+# utils/decode_log.py.
+set(TM4C_LOG_BUFFER 1024 CACHE STRING "Size of the TM4C_LOG ring in bytes")
+
+# Where stdout/stderr go. UART0 (default) or the text port of the ITM, which
+# leaves the chip on the SWO pin of the debug connector and frees the UART.
+# stdin always reads UART0.
+set(TM4C_STDIO_BACKEND
+  "UART"
+  CACHE STRING "Output of stdout/stderr (UART or ITM)")
+set(TM4C_STDIO_BACKEND_VALUES "UART" "ITM")
+set_property(CACHE TM4C_STDIO_BACKEND PROPERTY STRINGS ${TM4C_STDIO_BACKEND_VALUES})
+
+if(NOT TM4C_STDIO_BACKEND IN_LIST TM4C_STDIO_BACKEND_VALUES)
+  message(FATAL_ERROR "TM4C_STDIO_BACKEND must be one of ${TM4C_STDIO_BACKEND_VALUES}")
+endif()
+
+# ITM output (tm4c_itm.h). With a SWO bit rate the firmware sets up the TPIU
+# itself, 0 leaves it (and enabling the ITM) to the debugger. What writes do
+# when the ITM FIFO is full:
+#   BLOCK -- wait until the FIFO takes the data (default).
+#   DROP  -- discard the rest, never stall. Counted by tm4c_itm_dropped().
+set(TM4C_ITM_SWO_BAUD 0 CACHE STRING "SWO bit rate the firmware configures (0 = the debugger does)")
+set(TM4C_ITM_POLICY
+  "BLOCK"
+  CACHE STRING "What ITM writes do when the FIFO is full")
+set(TM4C_ITM_POLICY_VALUES "BLOCK" "DROP")
+set_property(CACHE TM4C_ITM_POLICY PROPERTY STRINGS ${TM4C_ITM_POLICY_VALUES})
+
+if(NOT TM4C_ITM_POLICY IN_LIST TM4C_ITM_POLICY_VALUES)
+  message(FATAL_ERROR "TM4C_ITM_POLICY must be one of ${TM4C_ITM_POLICY_VALUES}")
+endif()
+
+# newlib locks (tm4c_lock.h). Taking one masks the interrupts with this
+# priority (1-7) and lower ones, so those ISRs may use printf/malloc. ISRs with
+# a higher priority are never delayed and must stay out of the C library. The
+# debug mode counts contention and the longest time a lock was held, see
+# tm4c_lock_stats().
+set(TM4C_LIBC_LOCK_PRIORITY 1 CACHE STRING "Interrupt priority the C library locks mask (1-7)")
+option(TM4C_LIBC_LOCK_DEBUG "Count lock contention and hold times" OFF)
+
+# Log-structured filesystem (tm4c_fs.h) in the top TM4C_FS_SIZE bytes of flash,
+# behind open/read/write/lseek/unlink/stat and so fopen and std::fstream. A
+# multiple of 1 KB (the flash erase size) of at least 4 KB, the linker keeps
+# the program out of it. 0 leaves all flash to the program.
+set(TM4C_FS_SIZE 32768 CACHE STRING "Bytes of flash reserved for the filesystem (0 = none)")
+
+math(EXPR _tm4c_fs_rest "${TM4C_FS_SIZE} % 1024")
+if(NOT _tm4c_fs_rest EQUAL 0 OR (TM4C_FS_SIZE GREATER 0 AND TM4C_FS_SIZE LESS 4096))
+  message(FATAL_ERROR "TM4C_FS_SIZE must be 0 or a multiple of 1024 of at least 4096")
+endif()
+
+# EEPROM key-value store (tm4c_eeprom.h). The first TM4C_EEPROM_CACHE bytes of
+# the 2 KB EEPROM hold the records and are mirrored in RAM, a multiple of 64
+# (an EEPROM block). The CRC per record detects values a reset tore apart.
+set(TM4C_EEPROM_CACHE 512 CACHE STRING "Bytes of EEPROM the key-value store uses and caches in RAM")
+option(TM4C_EEPROM_CRC "Protect every EEPROM record with a CRC-32" ON)
+
+math(EXPR _tm4c_eeprom_rest "${TM4C_EEPROM_CACHE} % 64")
+if(NOT _tm4c_eeprom_rest EQUAL 0 OR TM4C_EEPROM_CACHE LESS 64 OR TM4C_EEPROM_CACHE GREATER 2048)
+  message(FATAL_ERROR "TM4C_EEPROM_CACHE must be a multiple of 64 from 64 to 2048")
+endif()
+
+# GPIO ports on the AHB instead of the legacy APB aperture, a string of port
+# letters (e.g. "F" or "AF"). The AHB aperture toggles pins in a single cycle
+# per store. Startup programs GPIOHBCTL before anything touches a port, the
+# addresses follow at compile time (tm4c_gpio.h, tm4c_gpio.hpp).
+set(TM4C_GPIO_AHB_PORTS "" CACHE STRING "GPIO ports accessed through the AHB aperture (letters A-F)")
+
+string(TOUPPER "${TM4C_GPIO_AHB_PORTS}" _tm4c_gpio_ports)
+if(NOT _tm4c_gpio_ports MATCHES "^[A-F]*$")
+  message(FATAL_ERROR "TM4C_GPIO_AHB_PORTS takes the port letters A to F, got '${TM4C_GPIO_AHB_PORTS}'")
+endif()
+
+# bit n of the mask is port A + n, like the bits of GPIOHBCTL
+set(TM4C_GPIO_AHB_MASK 0)
+foreach(_tm4c_gpio_port RANGE 0 5)
+  string(SUBSTRING "ABCDEF" ${_tm4c_gpio_port} 1 _tm4c_gpio_letter)
+  string(FIND "${_tm4c_gpio_ports}" "${_tm4c_gpio_letter}" _tm4c_gpio_found)
+  if(_tm4c_gpio_found GREATER_EQUAL 0)
+    math(EXPR TM4C_GPIO_AHB_MASK "${TM4C_GPIO_AHB_MASK} | (1 << ${_tm4c_gpio_port})")
+  endif()
+endforeach()
@@ -0,0 +1,18 @@
+###
+# Prints the dynamic initializers (C++ constructors of globals) every firmware
+# runs before main() right after it is linked. Use it to spot globals that
+# could be constinit/constexpr instead. See utils/static_init_report.py.
+###
+option(ENABLE_STATIC_INIT_REPORT "Report the dynamic initializers of every firmware" ON)
+
+find_package(Python3 COMPONENTS Interpreter)
+
+function(add_static_init_report target)
+  if(NOT ENABLE_STATIC_INIT_REPORT OR NOT Python3_Interpreter_FOUND)
+    return()
+  endif()
+
+  add_custom_command(TARGET ${target} POST_BUILD
+    COMMAND ${Python3_EXECUTABLE} ${PROJECT_SOURCE_DIR}/utils/static_init_report.py $<TARGET_FILE:${target}>
+    VERBATIM)
+endfunction()
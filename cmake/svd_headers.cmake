@@ -0,0 +1,41 @@
+###
+# Generates register definitions from a CMSIS-SVD file, one header per
+# peripheral group (tm4c_svd/gpio.hpp, tm4c_svd/sysctl.hpp, ...), see
+# utils/svd_to_cpp.py. The list of headers is taken at configure time, the
+# headers are written at build time by the <target>_headers target.
+#
+#   add_svd_headers(<target> <svd file> <include dir>)
+#
+# <target> is an INTERFACE library that puts the headers on the include path
+# of everything linking it.
+###
+find_package(Python3 REQUIRED COMPONENTS Interpreter)
+
+set(SVD_TO_CPP ${CMAKE_CURRENT_LIST_DIR}/../utils/svd_to_cpp.py)
+
+function(add_svd_headers target svd include_dir)
+  set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS ${svd} ${SVD_TO_CPP})
+
+  execute_process(
+    COMMAND ${Python3_EXECUTABLE} ${SVD_TO_CPP} --list ${svd}
+    OUTPUT_VARIABLE headers
+    OUTPUT_STRIP_TRAILING_WHITESPACE
+    COMMAND_ERROR_IS_FATAL ANY
+  )
+  string(REPLACE "\n" ";" headers "${headers}")
+  list(TRANSFORM headers PREPEND ${include_dir}/)
+
+  get_filename_component(svd_name ${svd} NAME)
+  add_custom_command(
+    OUTPUT ${headers}
+    COMMAND ${Python3_EXECUTABLE} ${SVD_TO_CPP} ${svd} --output ${include_dir}
+    DEPENDS ${svd} ${SVD_TO_CPP}
+    COMMENT "Generating register headers from ${svd_name}"
+    VERBATIM
+  )
+  add_custom_target(${target}_headers DEPENDS ${headers})
+
+  add_library(${target} INTERFACE)
+  add_dependencies(${target} ${target}_headers)
+  target_include_directories(${target} INTERFACE ${include_dir})
+endfunction()
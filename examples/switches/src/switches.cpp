@@ -14,7 +14,14 @@
  */
 #include <cstdint>
 
-#include "lm4f120h5qr.h"
+#include "tm4c_gpio.hpp"
+
+// Stores to these only change their own pins. They and the set up below
+// follow TM4C_GPIO_AHB_PORTS, port F may be on the APB or the AHB.
+using Leds = tm4c::gpio::PinGroup<tm4c::gpio::Port::F, 0x0E>;
+using Switches = tm4c::gpio::PinGroup<tm4c::gpio::Port::F, 0x11>;
+using Switch1 = tm4c::gpio::Pin<tm4c::gpio::Port::F, 4>;
+using Switch2 = tm4c::gpio::Pin<tm4c::gpio::Port::F, 0>;
 
 // The onboard LED colors
 static constexpr uint32_t LED_OFF = 0;
@@ -32,25 +39,14 @@ static constexpr uint32_t LED_WHITE = 0x0E;
  */
 static inline void init_port_f() {
     // 1. Enable the clock for the GPIO F register (5th bit)
-    SYSCTL_RCGCGPIO_R |= SYSCTL_RCGCGPIO_R5;
-
-    // 1a. Unlock Port F
-    GPIO_PORTF_LOCK_R = 0x4C4F434B; // 2) unlock Port F
-
-    // 1b. Allow changes to PF4-PF0
-    GPIO_PORTF_CR_R |= 0x1F;
-
-    // 2. Set the direction of the GPIO port pins
-    GPIO_PORTF_DIR_R |= 0b00001110; // C++14 binary literals
-
-    // 3. Set the GPIOAFSEL register to program each bit as GPIO or alternate
-    GPIO_PORTF_AFSEL_R = 0x00;
+    Leds::enable();
 
-    // 4. Program each pad in the port to have either pull-up, pull-down, or open drain
-    GPIO_PORTF_PUR_R |= 0b00010001;
+    // 2. The LEDs are digital outputs
+    Leds::make_output();
 
-    // 5. To enable GPIO pins as digital I/Os, set the appropriate DEN bit
-    GPIO_PORTF_DEN_R |= 0b00011111;
+    // 3. The switches are digital inputs with pull-ups. PF0 is locked, which
+    //    make_input() takes care of
+    Switches::make_input(tm4c::gpio::Pull::Up);
 }
 
 #include <array>
@@ -60,24 +56,24 @@ int main() {
 
     std::array<std::uint8_t, 100> buffer{};
 
-    GPIO_PORTF_DATA_R = LED_OFF;
+    Leds::write(LED_OFF);
 
     while (true) {
-        volatile std::uint32_t switch1 = GPIO_PORTF_DATA_R & 0x10;
-        volatile std::uint32_t switch2 = GPIO_PORTF_DATA_R & 0x01;
+        volatile bool switch1 = Switch1::is_high();
+        volatile bool switch2 = Switch2::is_high();
 
         // switches are negative logic
         if (switch1 && switch2) {           // no switch pressed
-            GPIO_PORTF_DATA_R = LED_OFF;
+            Leds::write(LED_OFF);
         }
         else if (!switch1 && switch2) {     // only switch1 pressed
-            GPIO_PORTF_DATA_R = LED_RED;
+            Leds::write(LED_RED);
         }
         else if (switch1 && !switch2) {      // only switch2 pressed
-            GPIO_PORTF_DATA_R = LED_GREEN;
+            Leds::write(LED_GREEN);
         }
         else {                              // both switches are pressed
-            GPIO_PORTF_DATA_R = LED_BLUE;
+            Leds::write(LED_BLUE);
         }
     }
 }
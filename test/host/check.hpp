@@ -0,0 +1,38 @@
+/**
+ * @file check.hpp
+ * @author Esteban Duran (@astroesteban)
+ * @brief Just enough of a test framework for the host tests.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#pragma once
+
+#include <cstdio>
+
+namespace check {
+
+inline int failures = 0;
+
+/**
+ * @brief Exit code of the test executable, non-zero if any check failed.
+ */
+inline int result() {
+    if (failures > 0) {
+        std::printf("%d check(s) failed\n", failures);
+    }
+    return failures > 0 ? 1 : 0;
+}
+
+} // namespace check
+
+#define CHECK(condition)                                                      \
+    do {                                                                      \
+        if (!(condition)) {                                                   \
+            std::printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__,      \
+                        #condition);                                          \
+            check::failures++;                                                \
+        }                                                                     \
+    } while (0)
@@ -0,0 +1,16 @@
+/**
+ * @file log_c.c
+ * @author Esteban Duran (@astroesteban)
+ * @brief TM4C_LOG calls from C, which encodes the arguments with _Generic
+ *        instead of the C++ template.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#include "tm4c_log.h"
+
+void log_from_c(const char *name, float ratio, double scale, int value, unsigned char byte) {
+    TM4C_LOG("c %s %f %f %d %c", name, ratio, scale, value, byte);
+}
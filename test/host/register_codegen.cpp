@@ -0,0 +1,145 @@
+/**
+ * @file register_codegen.cpp
+ * @author Esteban Duran (@astroesteban)
+ * @brief Pairs of functions doing the same register accesses, raw_* with the
+ *        lm4f120h5qr.h macros and reg_* with tm4c_register.hpp. Only compiled,
+ *        utils/compare_codegen.py compares their disassembly.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#include <climits>
+#include <cstdint>
+
+#include "lm4f120h5qr.h"
+#include "tm4c_gpio.hpp"
+#include "tm4c_register.hpp"
+
+// The macros access unsigned longs, which are 32 bits on the target only. On
+// a 64-bit host they are turned into 32-bit accesses at the same address.
+// RAW_BITS is GPIO_PORTx_DATA_BITS_R[mask], the data alias selecting mask.
+#if ULONG_MAX == 0xFFFFFFFFUL
+#define RAW(reg) reg
+#define RAW_BITS(bits, mask) (bits)[mask]
+#else
+#define RAW(reg) (*reinterpret_cast<volatile std::uint32_t *>(&(reg)))
+#define RAW_BITS(bits, mask) \
+    (*reinterpret_cast<volatile std::uint32_t *>(reinterpret_cast<std::uintptr_t>(bits) + ((mask) << 2)))
+#endif
+
+namespace {
+
+using RCGCGPIO = tm4c::Register<0x400FE608>;
+using RCC = tm4c::Register<0x400FE060>;
+using PORTF_DATA = tm4c::Register<0x400253FC>;
+using PORTF_DIR = tm4c::Register<0x40025400>;
+using PORTF_AFSEL = tm4c::Register<0x40025420>;
+using PORTF_PUR = tm4c::Register<0x40025510>;
+using PORTF_DEN = tm4c::Register<0x4002551C>;
+using PORTF_LOCK = tm4c::Register<0x40025520>;
+using PORTF_CR = tm4c::Register<0x40025524>;
+
+enum class Oscillator : std::uint32_t { Main = 0, Internal = 1, InternalBy4 = 2, LowFrequency = 3 };
+
+constexpr tm4c::Field<23, 4> SYSDIV;
+constexpr tm4c::Field<22, 1, bool> USESYSDIV;
+constexpr tm4c::Field<6, 5> XTAL;
+constexpr tm4c::Field<4, 2, Oscillator> OSCSRC;
+constexpr tm4c::Field<0, 32> ALL;
+
+constexpr std::uint32_t XTAL_16MHZ = 0x15;
+
+using RedLed = tm4c::gpio::Pin<tm4c::gpio::Port::F, 1>;
+using Rgb = tm4c::gpio::PinGroup<tm4c::gpio::Port::F, 0x0E>;
+
+} // namespace
+
+extern "C" {
+
+// The init_port_f() of the switches example
+void raw_init_port_f() {
+    RAW(SYSCTL_RCGCGPIO_R) |= SYSCTL_RCGCGPIO_R5;
+    RAW(GPIO_PORTF_LOCK_R) = 0x4C4F434B;
+    RAW(GPIO_PORTF_CR_R) |= 0x1F;
+    RAW(GPIO_PORTF_DIR_R) |= 0x0E;
+    RAW(GPIO_PORTF_AFSEL_R) = 0x00;
+    RAW(GPIO_PORTF_PUR_R) |= 0x11;
+    RAW(GPIO_PORTF_DEN_R) |= 0x1F;
+}
+
+void reg_init_port_f() {
+    RCGCGPIO::set(1U << 5);
+    PORTF_LOCK::write(0x4C4F434B);
+    PORTF_CR::set(0x1F);
+    PORTF_DIR::set(0x0E);
+    PORTF_AFSEL::write(0x00);
+    PORTF_PUR::set(0x11);
+    PORTF_DEN::set(0x1F);
+}
+
+// Four fields of RCC the way the macros are usually used, one at a time
+void raw_rcc_fields() {
+    RAW(SYSCTL_RCC_R) = (RAW(SYSCTL_RCC_R) & ~SYSCTL_RCC_XTAL_M) | SYSCTL_RCC_XTAL_16MHZ;
+    RAW(SYSCTL_RCC_R) = (RAW(SYSCTL_RCC_R) & ~SYSCTL_RCC_OSCSRC_M) | SYSCTL_RCC_OSCSRC_MAIN;
+    RAW(SYSCTL_RCC_R) |= SYSCTL_RCC_USESYSDIV;
+    RAW(SYSCTL_RCC_R) = (RAW(SYSCTL_RCC_R) & ~SYSCTL_RCC_SYSDIV_M) | (4UL << SYSCTL_RCC_SYSDIV_S);
+}
+
+// The same four fields merged by hand into one read-modify-write
+void raw_rcc_merged() {
+    RAW(SYSCTL_RCC_R) =
+        (RAW(SYSCTL_RCC_R) &
+         ~(SYSCTL_RCC_XTAL_M | SYSCTL_RCC_OSCSRC_M | SYSCTL_RCC_USESYSDIV | SYSCTL_RCC_SYSDIV_M)) |
+        SYSCTL_RCC_XTAL_16MHZ | SYSCTL_RCC_OSCSRC_MAIN | SYSCTL_RCC_USESYSDIV | (4UL << SYSCTL_RCC_SYSDIV_S);
+}
+
+void reg_rcc_fields() {
+    RCC::modify(XTAL(XTAL_16MHZ) | OSCSRC(Oscillator::Main) | USESYSDIV(true) | SYSDIV(4));
+}
+
+void reg_rcc_template() {
+    RCC::modify<XTAL(XTAL_16MHZ), OSCSRC(Oscillator::Main), USESYSDIV(true), SYSDIV(4)>();
+}
+
+std::uint32_t raw_get_sysdiv() {
+    return (RAW(SYSCTL_RCC_R) & SYSCTL_RCC_SYSDIV_M) >> SYSCTL_RCC_SYSDIV_S;
+}
+
+std::uint32_t reg_get_sysdiv() {
+    return RCC::get(SYSDIV);
+}
+
+// A field covering the whole register is stored without reading it first
+void raw_data_store() {
+    RAW(GPIO_PORTF_DATA_R) = 0x0E;
+}
+
+void reg_data_store() {
+    PORTF_DATA::modify(ALL(0x0E));
+}
+
+// One LED on, keeping the other pins of the port
+void raw_led_on() {
+    RAW(GPIO_PORTF_DATA_R) |= 0x02;
+}
+
+void raw_led_on_bits() {
+    RAW_BITS(GPIO_PORTF_DATA_BITS_R, 0x02) = 0x02;
+}
+
+void pin_led_on() {
+    RedLed::set();
+}
+
+// Three LEDs to a color, keeping the switch pins
+void raw_rgb_write(std::uint32_t color) {
+    RAW(GPIO_PORTF_DATA_R) = (RAW(GPIO_PORTF_DATA_R) & ~0x0EUL) | (color & 0x0E);
+}
+
+void pin_rgb_write(std::uint32_t color) {
+    Rgb::write(color);
+}
+
+} // extern "C"
@@ -0,0 +1,146 @@
+/**
+ * @file test_bitband.cpp
+ * @author Esteban Duran (@astroesteban)
+ * @brief Tests the bit-band helpers (tm4c_bitband.hpp). The alias addresses
+ *        are checked at compile time, the accesses against simulated alias
+ *        regions that change one bit per store like the bus does.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#include <cstdint>
+#include <map>
+
+#include "check.hpp"
+#include "tm4c_bitband.hpp"
+
+namespace {
+
+struct Memory {
+    std::map<std::uint32_t, std::uint32_t> registers;   // by register address
+    std::uint32_t alias_loads = 0;
+    std::uint32_t alias_stores = 0;
+};
+
+Memory memory;
+
+/// The register word and bit a peripheral alias address stands for
+void decode(std::uint32_t address, std::uint32_t &word, std::uint32_t &bit) {
+    const std::uint32_t offset = address - tm4c::bitband::peripheral_alias;
+    const std::uint32_t byte = tm4c::bitband::peripheral_start + (offset >> 5);
+    word = byte & ~3U;
+    bit = (byte & 3U) * 8 + ((offset >> 2) & 7U);
+}
+
+} // namespace
+
+extern "C" std::uint32_t tm4c_register_sim_read(std::uint32_t address) {
+    std::uint32_t word = 0;
+    std::uint32_t bit = 0;
+    decode(address, word, bit);
+    memory.alias_loads++;
+    return (memory.registers[word] >> bit) & 1U;
+}
+
+extern "C" void tm4c_register_sim_write(std::uint32_t address, std::uint32_t value) {
+    std::uint32_t word = 0;
+    std::uint32_t bit = 0;
+    decode(address, word, bit);
+    memory.alias_stores++;
+    memory.registers[word] = (memory.registers[word] & ~(1U << bit)) | ((value & 1U) << bit);
+}
+
+extern "C" std::uint32_t tm4c_bitband_sim_read(const volatile std::uint32_t *word, unsigned bit) {
+    memory.alias_loads++;
+    return (*word >> bit) & 1U;
+}
+
+extern "C" void tm4c_bitband_sim_write(volatile std::uint32_t *word, unsigned bit, std::uint32_t value) {
+    memory.alias_stores++;
+    *word = (*word & ~(1U << bit)) | ((value & 1U) << bit);
+}
+
+namespace {
+
+using tm4c::bitband::alias;
+
+// datasheet section 2.4.5, examples of the bit-band mapping
+static_assert(alias(0x20000000, 0) == 0x22000000);
+static_assert(alias(0x20000000, 7) == 0x2200001C);
+static_assert(alias(0x200FFFFF, 0) == 0x23FFFFE0);
+static_assert(alias(0x200FFFFF, 7) == 0x23FFFFFC);
+static_assert(alias(0x20000300, 2) == 0x22006008);
+// bits above 7 are in the next bytes of the word
+static_assert(alias(0x20000000, 8) == alias(0x20000001, 0));
+static_assert(alias(0x20000004, 31) == alias(0x20000007, 7));
+static_assert(alias(0x400FE608, 5) == 0x43FCC114);          // RCGCGPIO R5
+
+static_assert(tm4c::bitband::in_region(0x20007FFF));
+static_assert(!tm4c::bitband::in_region(0x20100000));
+static_assert(!tm4c::bitband::in_region(0x00001000));       // flash
+static_assert(!tm4c::bitband::in_region(0xE000E100));       // NVIC, private bus
+
+constexpr tm4c::Field<5, 1, bool> R5;
+using RCGCGPIO = tm4c::Register<0x400FE608>;
+static_assert(tm4c::bitband::FieldBit<RCGCGPIO, R5>::address == 0x43FCC114);
+
+void test_register_bits() {
+    using PortF = tm4c::bitband::Bit<0x400FE608, 5>;
+    using PortA = tm4c::bitband::FieldBit<RCGCGPIO, tm4c::Field<0, 1>{}>;
+
+    memory = Memory{};
+    memory.registers[0x400FE608] = 0x11;
+
+    PortF::set();
+    CHECK(memory.registers[0x400FE608] == 0x31);
+    CHECK(PortF::read());
+    PortA::clear();
+    CHECK(memory.registers[0x400FE608] == 0x30);
+    PortF::write(false);
+    CHECK(memory.registers[0x400FE608] == 0x10);
+    CHECK(!PortF::read());
+
+    // one store per change, the register itself is never loaded
+    CHECK(memory.alias_stores == 3);
+    CHECK(memory.alias_loads == 2);
+}
+
+void test_flags() {
+    memory = Memory{};
+
+    static constinit tm4c::bitband::BitFlag<40> flags;
+    tm4c::bitband::BitFlag<> single;
+
+    flags.set(3);
+    flags.set(31);
+    flags.set(32);
+    CHECK(flags.word(0) == 0x80000008);
+    CHECK(flags.word(1) == 0x01);
+    CHECK(flags.test(3));
+    CHECK(!flags.test(4));
+
+    flags.clear(3);
+    flags.write(39, true);
+    CHECK(flags.word(0) == 0x80000000);
+    CHECK(flags.word(1) == 0x81);
+
+    single.set();
+    CHECK(single.test());
+    single.clear();
+    CHECK(!single.test());
+    CHECK(single.word() == 0);
+
+    CHECK(memory.alias_stores == 7);
+    CHECK(memory.alias_loads == 4);
+}
+
+} // namespace
+
+int main() {
+    test_register_bits();
+    test_flags();
+
+    return check::result();
+}
@@ -0,0 +1,166 @@
+#!/usr/bin/env python3
+"""
+file name:
+    test_decoders.py
+
+details:
+    runs the host tools that decode what the firmware leaves behind
+    (decode_log.py, decode_swo.py and decode_crash.py) against a minimal ELF
+    built here. Like the firmware, it links .text and its strings at 0 and
+    carries the TM4C_LOG format strings in a section that is never loaded.
+
+example:
+    $ ./test_decoders.py ../../utils
+
+author(s):
+    @astroesteban
+"""
+import struct
+import subprocess
+import sys
+import tempfile
+import zlib
+from pathlib import Path
+
+SHT_PROGBITS = 1
+SHT_SYMTAB = 2
+SHT_STRTAB = 3
+SHT_NOBITS = 8
+SHF_ALLOC = 0x2
+SHF_EXECINSTR = 0x4
+STT_OBJECT = 1
+STT_FUNC = 2
+
+MAIN = 0x00000040               # a function, 0x40 bytes long
+CHANNEL = 0x00000100            # "vbus" in .rodata, which is part of .text
+LOG = 0x20000000                # the tm4c_log ring, 8 words of buffer
+CRASH = 0x20000100              # tm4c_crash_record
+
+STRINGS = b"boot\0adc %s: %d mV\0"
+TEMPLATE = 5                    # the ID of "adc %s: %d mV"
+
+failures = 0
+
+
+def check(condition, what):
+    global failures
+    if not condition:
+        print(f"FAILED: {what}")
+        failures += 1
+
+
+def elf():
+    """A 32-bit little endian ELF with the sections and symbols the tools use."""
+    text = bytearray(0x200)
+    text[CHANNEL:CHANNEL + 5] = b"vbus\0"
+
+    strtab = b"\0tm4c_log\0tm4c_crash_record\0main\0"
+    symtab = struct.pack("<IIIBBH", 0, 0, 0, 0, 0, 0)
+    symtab += struct.pack("<IIIBBH", 1, LOG, 4 * 11, STT_OBJECT, 0, 2)
+    symtab += struct.pack("<IIIBBH", 10, CRASH, 4 * 35, STT_OBJECT, 0, 2)
+    symtab += struct.pack("<IIIBBH", 28, MAIN | 1, 0x40, STT_FUNC, 0, 1)
+
+    names = b"\0.text\0.bss\0.tm4c_log\0.symtab\0.strtab\0.shstrtab\0"
+    # name, type, flags, addr, content, link, entry size
+    sections = [
+        (0, 0, 0, 0, b"", 0, 0),
+        (1, SHT_PROGBITS, SHF_ALLOC | SHF_EXECINSTR, 0, bytes(text), 0, 0),
+        (7, SHT_NOBITS, SHF_ALLOC, LOG, bytes(0x200), 0, 0),
+        (12, SHT_PROGBITS, 0, 0, STRINGS, 0, 0),
+        (22, SHT_SYMTAB, 0, 0, symtab, 5, 16),
+        (30, SHT_STRTAB, 0, 0, strtab, 0, 0),
+        (38, SHT_STRTAB, 0, 0, names, 0, 0),
+    ]
+
+    data = bytearray(52)
+    headers = b""
+    for name, kind, flags, addr, content, link, entsize in sections:
+        offset = len(data)
+        if kind != SHT_NOBITS:
+            data += content
+        headers += struct.pack("<10I", name, kind, flags, addr, offset, len(content),
+                               link, 0, 4, entsize)
+    shoff = len(data)
+    data += headers
+
+    data[0:16] = b"\x7fELF\x01\x01\x01" + bytes(9)
+    struct.pack_into("<HHIIIIIHHHHHH", data, 16, 2, 40, 1, MAIN | 1, 0, shoff, 0x05000400,
+                     52, 0, 0, 40, len(sections), len(sections) - 1)
+    return bytes(data)
+
+
+def record():
+    """The words of TM4C_LOG("adc %s: %d mV", "vbus", -12) logged at cycle 1000."""
+    header = (0xA5 << 24) | (2 << 20) | TEMPLATE
+    return [header, 1000, CHANNEL, -12 & 0xFFFFFFFF]
+
+
+def run(directory, tool, *args):
+    result = subprocess.run([sys.executable, str(Path(tool)), *map(str, args)],
+                            cwd=directory, capture_output=True, text=True, check=False)
+    check(result.returncode == 0, f"{tool.name} exits with 0: {result.stderr.strip()}")
+    return result.stdout
+
+
+def test_log(utils, directory):
+    words = record()
+
+    # the ring: head, tail, dropped and 8 words of buffer
+    ring = struct.pack("<11I", len(words), 0, 0, *words, *[0] * (8 - len(words)))
+    (directory / "log.bin").write_bytes(ring)
+    output = run(directory, utils / "decode_log.py", "firmware.elf", "log.bin")
+    check("[        1000] adc vbus: -12 mV" in output, f"ring dump decoded: {output!r}")
+
+    # a capture that starts in the middle of a record
+    capture = b"\x12\x34" + struct.pack("<4I", *words)
+    (directory / "uart.bin").write_bytes(capture)
+    output = run(directory, utils / "decode_log.py", "--stream", "--hz", "1000000",
+                 "firmware.elf", "uart.bin")
+    check("[  0.001000 s] adc vbus: -12 mV" in output, f"stream decoded: {output!r}")
+    check("(2 bytes did not belong to a record)" in output, f"skipped bytes counted: {output!r}")
+
+
+def test_swo(utils, directory):
+    # "hi" on port 0, the record as word packets on port 1
+    stream = b"\x01h\x01i"
+    for word in record():
+        stream += b"\x0B" + struct.pack("<I", word)
+    (directory / "swo.bin").write_bytes(stream)
+
+    output = run(directory, utils / "decode_swo.py", "--elf", "firmware.elf", "swo.bin")
+    check(output.startswith("hi"), f"text port decoded: {output!r}")
+    check("adc vbus: -12 mV" in output, f"log port decoded: {output!r}")
+
+
+def test_crash(utils, directory):
+    fields = [0x43524153, 1, 1, 3,                    # magic, version, count, HardFault
+              0, 0, 0, 0, 0,                          # r0-r3, r12
+              MAIN + 0x11, MAIN + 0x20, 0x01000000,   # lr, pc, xpsr
+              0xFFFFFFF9, 0x20007FE0,                 # exc_return, sp
+              0x00008200, 0x40000000, 0, 0xDEADBEEF]  # cfsr, hfsr, mmfar, bfar
+    data = struct.pack("<34I", *fields, *[0] * 16)
+    (directory / "crash.bin").write_bytes(data + struct.pack("<I", zlib.crc32(data)))
+
+    output = run(directory, utils / "decode_crash.py", "firmware.elf", "crash.bin")
+    check("Crash #1: HardFault (vector 3)" in output, f"crash decoded: {output!r}")
+    check("PRECISERR BFARVALID" in output, f"CFSR decoded: {output!r}")
+    check("BFAR 0xdeadbeef" in output, f"BFAR printed: {output!r}")
+    pc = next((line for line in output.splitlines() if line.strip().startswith("pc")), "")
+    check("main" in pc, f"pc resolved to main: {pc!r}")
+
+
+def main():
+    utils = Path(sys.argv[1]).resolve()
+
+    with tempfile.TemporaryDirectory() as temporary:
+        directory = Path(temporary)
+        (directory / "firmware.elf").write_bytes(elf())
+        test_log(utils, directory)
+        test_swo(utils, directory)
+        test_crash(utils, directory)
+
+    return 1 if failures else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,306 @@
+/**
+ * @file test_eeprom.cpp
+ * @author Esteban Duran (@astroesteban)
+ * @brief Tests the cached EEPROM key-value store (eeprom.c) against a
+ *        simulated EEPROM, including resets in the middle of a flush.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#include <array>
+#include <cerrno>
+#include <cstdint>
+#include <map>
+#include <string_view>
+
+#include "check.hpp"
+#include "tm4c_eeprom.h"
+#include "tm4c_eeprom.hpp"
+
+extern "C" void tm4c_eeprom_sim_reset(void);
+
+namespace {
+
+constexpr std::uint32_t EESIZE = 0x400AF000;
+constexpr std::uint32_t EEBLOCK = 0x400AF004;
+constexpr std::uint32_t EEOFFSET = 0x400AF008;
+constexpr std::uint32_t EERDWRINC = 0x400AF014;
+constexpr std::uint32_t PREEPROM = 0x400FEA58;
+
+/// The EEPROM as far as eeprom.c sees it
+struct Eeprom {
+    std::array<std::uint32_t, TM4C_EEPROM_SIZE / 4> words;
+    std::map<std::uint32_t, std::uint32_t> registers;
+    std::uint32_t block = 0;
+    std::uint32_t offset = 0;
+    std::uint32_t writes = 0;
+    std::uint32_t seeks = 0;
+    int budget = -1;                    // writes before the power fails, -1 = never
+
+    Eeprom() { words.fill(0xFFFFFFFFU); }
+};
+
+Eeprom eeprom;
+
+} // namespace
+
+extern "C" std::uint32_t tm4c_eeprom_sim_read(std::uint32_t address) {
+    switch (address) {
+    case EESIZE:
+        return (TM4C_EEPROM_SIZE / 64) << 16 | TM4C_EEPROM_SIZE / 4;
+    case PREEPROM:
+        return 1;
+    case EERDWRINC: {
+        const std::uint32_t value = eeprom.words[eeprom.block * 16 + eeprom.offset];
+        eeprom.offset = (eeprom.offset + 1) % 16;
+        return value;
+    }
+    default:
+        return eeprom.registers[address];
+    }
+}
+
+extern "C" void tm4c_eeprom_sim_write(std::uint32_t address, std::uint32_t value) {
+    switch (address) {
+    case EEBLOCK:
+        eeprom.block = value;
+        eeprom.seeks++;
+        break;
+    case EEOFFSET:
+        eeprom.offset = value;
+        break;
+    case EERDWRINC:
+        if (eeprom.budget != 0) {
+            eeprom.words[eeprom.block * 16 + eeprom.offset] = value;
+            eeprom.writes++;
+            eeprom.budget -= eeprom.budget > 0 ? 1 : 0;
+        }
+        // the offset wraps around within the block
+        eeprom.offset = (eeprom.offset + 1) % 16;
+        break;
+    default:
+        eeprom.registers[address] = value;
+        break;
+    }
+}
+
+namespace {
+
+struct Calibration {
+    float gain;
+    float offset;
+    std::uint16_t points[5];
+};
+
+void reset() {
+    tm4c_eeprom_sim_reset();
+    eeprom.budget = -1;
+}
+
+void fresh() {
+    eeprom = Eeprom{};
+    reset();
+    CHECK(tm4c_eeprom_init() == 0);
+}
+
+void test_empty_store() {
+    fresh();
+
+    std::uint32_t value = 0;
+    CHECK(tm4c_eeprom_get(1, &value, sizeof(value)) == -ENOENT);
+
+    // the magic word and the end marker
+    const tm4c_eeprom_stats_t stats = tm4c_eeprom_stats();
+    CHECK(stats.records == 0);
+    CHECK(stats.used_bytes == 4);
+    CHECK(tm4c_eeprom_flush() == 1);
+    CHECK(eeprom.writes == 1);
+    CHECK(tm4c_eeprom_flush() == 0);
+
+    reset();
+    CHECK(tm4c_eeprom_stats().records == 0);
+    CHECK(tm4c_eeprom_flush() == 0);
+}
+
+void test_reads_come_from_the_cache() {
+    fresh();
+
+    constexpr tm4c::Setting<std::uint32_t, 1> baud;
+    constexpr tm4c::Setting<Calibration, 2> calibration;
+
+    CHECK(baud.get(115200) == 115200);
+    CHECK(!baud.exists());
+    CHECK(baud.set(9600));
+    CHECK(calibration.set({1.5f, -0.25f, {1, 2, 3, 4, 5}}));
+    CHECK(baud.get(115200) == 9600);
+    CHECK(calibration.get().points[4] == 5);
+    CHECK(eeprom.writes == 0);
+
+    const int written = tm4c_eeprom_flush();
+    CHECK(written > 0);
+    CHECK(eeprom.writes == static_cast<std::uint32_t>(written));
+
+    // reading never touches the EEPROM once loaded
+    const std::uint32_t seeks = eeprom.seeks;
+    for (int i = 0; i < 100; i++) {
+        CHECK(baud.get() == 9600);
+    }
+    CHECK(eeprom.seeks == seeks);
+
+    reset();
+    CHECK(baud.get() == 9600);
+    CHECK(calibration.get().gain == 1.5f);
+    CHECK(calibration.get().offset == -0.25f);
+    CHECK(tm4c_eeprom_stats().records == 2);
+}
+
+void test_writes_coalesce() {
+    fresh();
+    tm4c_eeprom_flush();
+
+    constexpr tm4c::Setting<std::array<std::uint32_t, 8>, 7> table;
+    std::array<std::uint32_t, 8> values{};
+    CHECK(table.set(values));
+    tm4c_eeprom_flush();
+
+    // many sets of one word between flushes write it once, plus the CRC
+    const std::uint32_t writes = eeprom.writes;
+    for (std::uint32_t i = 0; i < 50; i++) {
+        values[3] = i;
+        CHECK(table.set(values));
+    }
+    CHECK(tm4c_eeprom_stats().dirty_words == 2);
+    CHECK(tm4c_eeprom_flush() == 2);
+    CHECK(eeprom.writes == writes + 2);
+
+    // setting what is stored already writes nothing
+    CHECK(table.set(values));
+    CHECK(tm4c_eeprom_flush() == 0);
+
+    // the changed words of a value go out in one run with a single seek
+    values.fill(0xAB);
+    CHECK(table.set(values));
+    const std::uint32_t seeks = eeprom.seeks;
+    CHECK(tm4c_eeprom_flush() == 9);
+    CHECK(eeprom.seeks - seeks <= 2);     // one more where the run crosses a block
+
+    reset();
+    CHECK(table.get() == values);
+}
+
+void test_sizes_and_space() {
+    fresh();
+
+    std::uint16_t small = 7;
+    std::uint32_t wide = 0;
+    CHECK(tm4c_eeprom_set(3, &small, sizeof(small)) == 0);
+    CHECK(tm4c_eeprom_set(3, &wide, sizeof(wide)) == -EINVAL);
+    CHECK(tm4c_eeprom_get(3, &wide, sizeof(wide)) == -EINVAL);
+    CHECK(tm4c_eeprom_set(0xFFFF, &wide, sizeof(wide)) == -EINVAL);
+    CHECK(tm4c_eeprom_set(4, &wide, 0) == -EINVAL);
+
+    // odd sizes keep their bytes
+    const char text[7] = "abcdef";
+    char back[7] = {};
+    CHECK(tm4c_eeprom_set(5, text, sizeof(text)) == 0);
+    CHECK(tm4c_eeprom_get(5, back, sizeof(back)) == 0);
+    CHECK(std::string_view(back) == "abcdef");
+
+    std::uint16_t key = 100;
+    while (tm4c_eeprom_set(key, &wide, sizeof(wide)) == 0) {
+        key++;
+    }
+    CHECK(tm4c_eeprom_stats().used_bytes > TM4C_EEPROM_CACHE - 12);
+    CHECK(tm4c_eeprom_set(key, &wide, sizeof(wide)) == -ENOSPC);
+    tm4c_eeprom_flush();
+
+    reset();
+    CHECK(tm4c_eeprom_get(key - 1, &wide, sizeof(wide)) == 0);
+    CHECK(tm4c_eeprom_get(3, &small, sizeof(small)) == 0);
+    CHECK(small == 7);
+
+    CHECK(tm4c_eeprom_clear() == 0);
+    CHECK(tm4c_eeprom_get(3, &small, sizeof(small)) == -ENOENT);
+    CHECK(tm4c_eeprom_set(3, &wide, sizeof(wide)) == 0);
+    tm4c_eeprom_flush();
+    reset();
+    CHECK(tm4c_eeprom_stats().records == 1);
+    CHECK(tm4c_eeprom_get(3, &wide, sizeof(wide)) == 0);
+}
+
+/**
+ * @brief Resets after every number of words a flush writes. Values are old,
+ *        new or (torn) reported as such, new keys appear completely or not.
+ */
+void test_torn_flushes() {
+    constexpr tm4c::Setting<std::array<std::uint32_t, 6>, 1> old_key;
+    constexpr tm4c::Setting<std::array<std::uint32_t, 6>, 2> new_key;
+    const std::array<std::uint32_t, 6> before{1, 2, 3, 4, 5, 6};
+    const std::array<std::uint32_t, 6> after{9, 9, 9, 9, 9, 9};
+
+    fresh();
+    CHECK(old_key.set(before));
+    tm4c_eeprom_flush();
+    const Eeprom saved = eeprom;
+
+    for (int budget = 0;; budget++) {
+        eeprom = saved;
+        reset();
+        CHECK(old_key.set(after));
+        CHECK(new_key.set(after));
+        eeprom.budget = budget;
+        tm4c_eeprom_flush();
+        const bool completed = eeprom.budget != 0;
+
+        reset();
+        std::array<std::uint32_t, 6> value{};
+        const int old_result = tm4c_eeprom_get(1, &value, sizeof(value));
+        CHECK(old_result == -EBADMSG || (old_result == 0 && (value == before || value == after)));
+        const int new_result = tm4c_eeprom_get(2, &value, sizeof(value));
+        CHECK(new_result == -ENOENT || (new_result == 0 && value == after));
+
+        // a torn value is fixed by setting it again
+        CHECK(old_key.set(before));
+        CHECK(old_key.get() == before);
+        tm4c_eeprom_flush();
+        reset();
+        CHECK(old_key.get() == before);
+
+        if (completed) {
+            CHECK(new_result == 0);
+            break;
+        }
+    }
+}
+
+void test_fresh_store_is_committed_last() {
+    for (int budget = 0; budget < 4; budget++) {
+        eeprom = Eeprom{};
+        eeprom.words[5] = 0x12345678;       // leftovers of something else
+        reset();
+        CHECK(tm4c_eeprom_set(9, &budget, sizeof(budget)) == 0);
+        eeprom.budget = budget;
+        tm4c_eeprom_flush();
+
+        reset();
+        int value = -1;
+        const int result = tm4c_eeprom_get(9, &value, sizeof(value));
+        CHECK(result == -ENOENT || (result == 0 && value == budget));
+        CHECK(tm4c_eeprom_stats().records <= 1);
+    }
+}
+
+} // namespace
+
+int main() {
+    test_empty_store();
+    test_reads_come_from_the_cache();
+    test_writes_coalesce();
+    test_sizes_and_space();
+    test_torn_flushes();
+    test_fresh_store_is_committed_last();
+
+    return check::result();
+}
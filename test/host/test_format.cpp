@@ -0,0 +1,209 @@
+/**
+ * @file test_format.cpp
+ * @author Esteban Duran (@astroesteban)
+ * @brief Tests the compile-time parsed formatting (tm4c_format.hpp), the
+ *        numbers against the host's printf.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+#include <string_view>
+
+#include "check.hpp"
+#include "tm4c_format.hpp"
+
+namespace {
+
+template <typename... Args>
+std::string format(tm4c::FormatString<std::type_identity_t<Args>...> format, const Args &...args) {
+    std::string text;
+
+    tm4c::format_to([&text](const char *data, std::size_t size) { text.append(data, size); },
+                    format, args...);
+    return text;
+}
+
+template <typename... Args>
+std::string printf_text(const char *format, Args... args) {
+    char text[128];
+
+    std::snprintf(text, sizeof(text), format, args...);
+    return text;
+}
+
+void test_literal_text() {
+    CHECK(format("") == "");
+    CHECK(format("plain text") == "plain text");
+    CHECK(format("{{}} and {{{}}}", 7) == "{} and {7}");
+    CHECK(format("{}{}{}", 'a', 'b', 'c') == "abc");
+}
+
+void test_integers() {
+    CHECK(format("{}", 0) == "0");
+    CHECK(format("{} {}", -1234, 5678U) == "-1234 5678");
+    CHECK(format("{}", std::numeric_limits<std::int32_t>::min()) == "-2147483648");
+    CHECK(format("{}", std::numeric_limits<std::int64_t>::min()) == "-9223372036854775808");
+    CHECK(format("{}", std::numeric_limits<std::uint64_t>::max()) == "18446744073709551615");
+    CHECK(format("{}", 10000000000000000000ULL) == "10000000000000000000");
+    CHECK(format("{}", static_cast<std::int8_t>(-5)) == "-5");
+
+    CHECK(format("{:x} {:X} {:o} {:b}", 0xBEEFU, 0xBEEFU, 8, 5) == "beef BEEF 10 101");
+    CHECK(format("{:#x} {:#X} {:#o} {:#b} {:#o}", 255, 255, 8, 5, 0) == "0xff 0XFF 010 0b101 0");
+    CHECK(format("{:x}", 0xFEDCBA9876543210ULL) == "fedcba9876543210");
+    CHECK(format("{:#010x}", 0x1234) == "0x00001234");
+    CHECK(format("{:08}", -42) == "-0000042");
+    CHECK(format("{:+} {:+} {: }", 1, -1, 1) == "+1 -1  1");
+    CHECK(format("{:c}", 65) == "A");
+
+    for (std::uint32_t value : {0U, 9U, 10U, 99U, 4294967295U, 1000000000U}) {
+        CHECK(format("{}", value) == printf_text("%u", value));
+    }
+}
+
+void test_alignment() {
+    CHECK(format("[{:6}]", 42) == "[    42]");
+    CHECK(format("[{:<6}]", 42) == "[42    ]");
+    CHECK(format("[{:^6}]", 42) == "[  42  ]");
+    CHECK(format("[{:*^7}]", "ab") == "[**ab***]");
+    CHECK(format("[{:6}]", "ab") == "[ab    ]");
+    CHECK(format("[{:>6}]", 'x') == "[     x]");
+    CHECK(format("[{:<08}]", 42) == "[42      ]");     // alignment wins over '0'
+    CHECK(format("[{:2}]", 12345) == "[12345]");
+}
+
+void test_other_types() {
+    CHECK(format("{} {}", true, false) == "true false");
+    CHECK(format("{:d}", true) == "1");
+    CHECK(format("{:x}", 'A') == "41");
+
+    const char *pointer_to_text = "pointer";
+    char array[] = "array";
+    const std::string_view view{"view and more", 4};
+    CHECK(format("{} {} {} {}", "literal", pointer_to_text, array, view) ==
+          "literal pointer array view");
+    CHECK(format("{:.3}", "truncated") == "tru");
+
+    int value = 0;
+    CHECK(format("{}", static_cast<const void *>(&value)) == printf_text("%p", static_cast<void *>(&value)));
+    CHECK(format("{}", nullptr) == "0x0");
+}
+
+void test_fixed_float() {
+    CHECK(format("{:f}", 0.1f) == "0.100000");
+    CHECK(format("{:.9f}", 0.1f) == "0.100000001");
+    // 21.55f is 21.5499992...
+    CHECK(format("{:.1f} {:.0f}", 21.55f, 2.5f) == "21.5 2");
+    CHECK(format("{:.2f}", -0.001f) == "-0.00");
+    CHECK(format("{:.2f}", 9.999f) == "10.00");
+    CHECK(format("{:.0f} {:.0f} {:.0f}", 0.5, 1.5, 0.5000001) == "0 2 1");
+    CHECK(format("{:+.1f} {:08.3f}", 3.0f, -3.14159f) == "+3.0 -003.142");
+    CHECK(format("{:.3f}", 1e19f) == printf_text("%.3f", static_cast<double>(1e19f)));
+
+    // without type and precision the trailing zeros go
+    CHECK(format("{} {} {} {}", 1.5f, 2.0f, 0.25, -0.0f) == "1.5 2 0.25 -0");
+    CHECK(format("{}", 1e-9f) == "0");
+
+    std::mt19937 random{12345};
+    for (int i = 0; i < 20000; i++) {
+        const auto bits = static_cast<std::uint32_t>(random());
+        const float value = std::bit_cast<float>(bits & 0xCFFFFFFFU);  // below 2^64
+        const int precision = i % 10;
+
+        if (!std::isfinite(value)) {
+            continue;
+        }
+        char expected[64];
+        char actual[64];
+        std::snprintf(expected, sizeof(expected), "%.*f", precision, static_cast<double>(value));
+        switch (precision) {
+        case 0: tm4c::snformat(actual, sizeof(actual), "{:.0f}", value); break;
+        case 1: tm4c::snformat(actual, sizeof(actual), "{:.1f}", value); break;
+        case 2: tm4c::snformat(actual, sizeof(actual), "{:.2f}", value); break;
+        case 3: tm4c::snformat(actual, sizeof(actual), "{:.3f}", value); break;
+        case 4: tm4c::snformat(actual, sizeof(actual), "{:.4f}", value); break;
+        case 5: tm4c::snformat(actual, sizeof(actual), "{:.5f}", value); break;
+        case 6: tm4c::snformat(actual, sizeof(actual), "{:f}", value); break;
+        case 7: tm4c::snformat(actual, sizeof(actual), "{:.7f}", value); break;
+        case 8: tm4c::snformat(actual, sizeof(actual), "{:.8f}", value); break;
+        default: tm4c::snformat(actual, sizeof(actual), "{:.9f}", value); break;
+        }
+        if (std::strcmp(expected, actual) != 0) {
+            std::printf("%s != %s\n", actual, expected);
+            CHECK(false);
+            break;
+        }
+    }
+
+    std::uniform_real_distribution<double> doubles{-1e6, 1e6};
+    for (int i = 0; i < 20000; i++) {
+        const double value = doubles(random);
+
+        CHECK(format("{:.9f}", value) == printf_text("%.9f", value));
+    }
+}
+
+void test_large_and_special_floats() {
+    CHECK(format("{} {:.8f}", 1e20f, 1e20f) == "1e+20 1.00000002e+20");
+    CHECK(format("{:.3f}", 3.4028235e38f) == "3.403e+38");
+    CHECK(format("{:.2f}", -1e300) == "-1.00e+300");
+    CHECK(format("{:.0f}", 1e100) == "1e+100");
+    CHECK(format("{} {} {}", INFINITY, -INFINITY, NAN) == "inf -inf nan");
+    CHECK(format("{:06}", INFINITY) == "   inf");
+
+    for (double value : {1.2345e30, 9.9999999999e25, 6.02214076e23, 1.7976931348623157e308}) {
+        CHECK(format("{:.6f}", value) == printf_text("%.6e", value));
+    }
+}
+
+void test_snformat_truncates() {
+    char text[8];
+
+    CHECK(tm4c::snformat(text, sizeof(text), "{} and {}", 12345, 67890) == 15);
+    CHECK(std::strcmp(text, "12345 a") == 0);
+
+    CHECK(tm4c::snformat(text, sizeof(text), "{:>5}", 1) == 5);
+    CHECK(std::strcmp(text, "    1") == 0);
+
+    CHECK(tm4c::snformat(nullptr, 0, "{}", 123) == 3);
+}
+
+void test_sink_gets_chunks() {
+    std::string text;
+    std::size_t calls = 0;
+    auto sink = [&](const char *data, std::size_t size) {
+        CHECK(size <= TM4C_FORMAT_BUFFER);
+        text.append(data, size);
+        calls++;
+    };
+
+    const std::size_t size = tm4c::format_to(sink, "{:-^150}|{:0200}", "middle", 7);
+    CHECK(size == 351);
+    CHECK(text.size() == 351);
+    CHECK(text.substr(72, 6) == "middle");
+    CHECK(text.back() == '7');
+    CHECK(calls == (351 + TM4C_FORMAT_BUFFER - 1) / TM4C_FORMAT_BUFFER);
+}
+
+} // namespace
+
+int main() {
+    test_literal_text();
+    test_integers();
+    test_alignment();
+    test_other_types();
+    test_fixed_float();
+    test_large_and_special_floats();
+    test_snformat_truncates();
+    test_sink_gets_chunks();
+
+    return check::result();
+}
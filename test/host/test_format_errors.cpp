@@ -0,0 +1,39 @@
+/**
+ * @file test_format_errors.cpp
+ * @author Esteban Duran (@astroesteban)
+ * @brief Format strings that must not compile, one per FORMAT_ERROR case.
+ *        CMake builds each case and expects the build to fail.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#include <cstddef>
+
+#include "tm4c_format.hpp"
+
+int main() {
+    char text[16];
+
+#if FORMAT_ERROR == 0
+    // the well-formed baseline, proves the other cases fail for their error
+    tm4c::snformat(text, sizeof(text), "{:#06x} {:.2f}", 42, 1.5f);
+#elif FORMAT_ERROR == 1
+    tm4c::snformat(text, sizeof(text), "{} {}", 42);
+#elif FORMAT_ERROR == 2
+    tm4c::snformat(text, sizeof(text), "{}", 42, 43);
+#elif FORMAT_ERROR == 3
+    tm4c::snformat(text, sizeof(text), "{:.2f}", 42);
+#elif FORMAT_ERROR == 4
+    tm4c::snformat(text, sizeof(text), "{:x}", "text");
+#elif FORMAT_ERROR == 5
+    tm4c::snformat(text, sizeof(text), "{:.10f}", 1.5f);
+#elif FORMAT_ERROR == 6
+    tm4c::snformat(text, sizeof(text), "unmatched }");
+#elif FORMAT_ERROR == 7
+    tm4c::snformat(text, sizeof(text), "{0}", 42);
+#endif
+
+    return static_cast<int>(text[0]);
+}
@@ -0,0 +1,493 @@
+/**
+ * @file test_fs.cpp
+ * @author Esteban Duran (@astroesteban)
+ * @brief Tests the flash filesystem (fs.c) against flash simulated in RAM,
+ *        including resets in the middle of every flash operation.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <initializer_list>
+#include <string>
+#include <unistd.h>
+
+#include "check.hpp"
+#include "tm4c_fs.h"
+
+namespace {
+
+/**
+ * @brief NOR flash: erasing sets a block to ones, programming can only clear
+ *        bits. A power budget runs out in the middle of an operation.
+ */
+struct Flash {
+    std::array<std::uint32_t, TM4C_FS_SIZE / 4> words;
+    std::array<std::uint32_t, TM4C_FS_BLOCKS> erases{};
+    std::uint32_t reprogrammed = 0;     // words programmed that were not erased
+    std::uint32_t programs = 0;
+    int budget = -1;                    // operations left before the power fails, -1 = never
+    bool off = false;                   // the power failed, nothing changes any more
+
+    Flash() { words.fill(0xA5A5A5A5U); }  // never formatted
+
+    /**
+     * @return int 1 if the operation completes, 0 if the power fails in its
+     *         middle and -1 if it was already off.
+     */
+    int power() {
+        if (off) {
+            return -1;
+        }
+        if (budget == 0) {
+            off = true;
+            return 0;
+        }
+        if (budget > 0) {
+            budget--;
+        }
+        return 1;
+    }
+
+    std::uint32_t total_erases() const {
+        std::uint32_t total = 0;
+        for (std::uint32_t count : erases) {
+            total += count;
+        }
+        return total;
+    }
+};
+
+Flash flash;
+
+} // namespace
+
+extern "C" const std::uint32_t *tm4c_fs_sim_region() {
+    return flash.words.data();
+}
+
+extern "C" int tm4c_fs_sim_erase(std::uint32_t offset) {
+    const std::uint32_t first = offset / 4;
+    const std::uint32_t count = TM4C_FS_BLOCK_SIZE / 4;
+
+    const int power = flash.power();
+    if (power <= 0) {
+        // cut halfway, the rest keeps what it had
+        std::fill_n(flash.words.begin() + first, power == 0 ? count / 2 : 0, 0xFFFFFFFFU);
+        return -1;
+    }
+    std::fill_n(flash.words.begin() + first, count, 0xFFFFFFFFU);
+    flash.erases[offset / TM4C_FS_BLOCK_SIZE]++;
+    return 0;
+}
+
+extern "C" int tm4c_fs_sim_program(std::uint32_t offset, const std::uint32_t *words,
+                                   std::uint32_t count) {
+    const int power = flash.power();
+    // cut in the middle only the first half of the words make it
+    const std::uint32_t programmed = power > 0 ? count : power == 0 ? count / 2 : 0;
+
+    for (std::uint32_t i = 0; i < programmed; i++) {
+        std::uint32_t &word = flash.words[offset / 4 + i];
+
+        flash.reprogrammed += word != 0xFFFFFFFFU ? 1 : 0;
+        word &= words[i];
+    }
+    flash.programs++;
+    return power > 0 ? 0 : -1;
+}
+
+namespace {
+
+std::string read_file(const char *name) {
+    const int fd = tm4c_fs_open(name, O_RDONLY);
+    std::string text;
+    char buffer[100];
+
+    if (fd < 0) {
+        return "<" + std::to_string(-fd) + ">";
+    }
+    for (int count; (count = tm4c_fs_read(fd, buffer, sizeof(buffer))) > 0;) {
+        text.append(buffer, static_cast<std::size_t>(count));
+    }
+    tm4c_fs_close(fd);
+    return text;
+}
+
+bool write_file(const char *name, const std::string &text, int flags = O_CREAT | O_TRUNC) {
+    const int fd = tm4c_fs_open(name, O_WRONLY | flags);
+
+    if (fd < 0) {
+        return false;
+    }
+    const int written = tm4c_fs_write(fd, text.data(), text.size());
+    tm4c_fs_close(fd);
+    return written == static_cast<int>(text.size());
+}
+
+std::string pattern(std::size_t size, unsigned seed) {
+    std::string text(size, '\0');
+
+    for (std::size_t i = 0; i < size; i++) {
+        text[i] = static_cast<char>('a' + (i * 7 + seed) % 26);
+    }
+    return text;
+}
+
+void fresh() {
+    flash = Flash{};
+    CHECK(tm4c_fs_mount() == 0);
+}
+
+void test_mount_formats() {
+    fresh();
+
+    tm4c_fs_stats_t stats;
+    CHECK(tm4c_fs_stats(&stats) == 0);
+    CHECK(stats.files == 0);
+    CHECK(stats.live_bytes == 0);
+    CHECK(stats.max_erase_count == 0);
+    CHECK(stats.free_bytes > TM4C_FS_SIZE / 2);
+    CHECK(flash.total_erases() == TM4C_FS_BLOCKS);
+}
+
+void test_read_write() {
+    fresh();
+
+    const int fd = tm4c_fs_open("config.txt", O_RDWR | O_CREAT);
+    CHECK(fd == TM4C_FS_FD_FIRST);
+    CHECK(tm4c_fs_write(fd, "hello ", 6) == 6);
+    CHECK(tm4c_fs_write(fd, "flash", 5) == 5);
+    CHECK(tm4c_fs_lseek(fd, 0, SEEK_CUR) == 11);
+
+    char text[32] = {};
+    CHECK(tm4c_fs_read(fd, text, sizeof(text)) == 0);
+    CHECK(tm4c_fs_lseek(fd, 6, SEEK_SET) == 6);
+    CHECK(tm4c_fs_read(fd, text, sizeof(text)) == 5);
+    CHECK(std::memcmp(text, "flash", 5) == 0);
+    CHECK(tm4c_fs_lseek(fd, -3, SEEK_END) == 8);
+    CHECK(tm4c_fs_lseek(fd, -30, SEEK_END) == -EINVAL);
+
+    struct stat st;
+    CHECK(tm4c_fs_fstat(fd, &st) == 0);
+    CHECK(st.st_size == 11);
+    CHECK(S_ISREG(st.st_mode));
+    CHECK(tm4c_fs_close(fd) == 0);
+    CHECK(tm4c_fs_close(fd) == -EBADF);
+    CHECK(tm4c_fs_read(fd, text, 1) == -EBADF);
+
+    CHECK(tm4c_fs_stat("config.txt", &st) == 0);
+    CHECK(st.st_size == 11);
+    CHECK(read_file("config.txt") == "hello flash");
+
+    // a gap behind the end reads as zeros
+    const int sparse = tm4c_fs_open("sparse", O_WRONLY | O_CREAT);
+    CHECK(tm4c_fs_lseek(sparse, 4, SEEK_SET) == 4);
+    CHECK(tm4c_fs_write(sparse, "x", 1) == 1);
+    CHECK(tm4c_fs_close(sparse) == 0);
+    CHECK(read_file("sparse") == std::string("\0\0\0\0x", 5));
+
+    // access modes
+    const int read_only = tm4c_fs_open("config.txt", O_RDONLY);
+    CHECK(tm4c_fs_write(read_only, "x", 1) == -EBADF);
+    tm4c_fs_close(read_only);
+    const int write_only = tm4c_fs_open("config.txt", O_WRONLY | O_APPEND);
+    CHECK(tm4c_fs_read(write_only, text, 1) == -EBADF);
+    CHECK(tm4c_fs_write(write_only, "!", 1) == 1);
+    tm4c_fs_close(write_only);
+    CHECK(read_file("config.txt") == "hello flash!");
+}
+
+void test_open_errors() {
+    fresh();
+
+    CHECK(tm4c_fs_open("missing", O_RDONLY) == -ENOENT);
+    CHECK(tm4c_fs_open("", O_RDWR | O_CREAT) == -ENOENT);
+    CHECK(tm4c_fs_open(std::string(TM4C_FS_NAME_MAX + 1, 'n').c_str(), O_RDWR | O_CREAT) == -ENAMETOOLONG);
+    CHECK(write_file(std::string(TM4C_FS_NAME_MAX, 'n').c_str(), "long name"));
+    CHECK(read_file(std::string(TM4C_FS_NAME_MAX, 'n').c_str()) == "long name");
+
+    CHECK(write_file("a", "a"));
+    CHECK(tm4c_fs_open("a", O_RDWR | O_CREAT | O_EXCL) == -EEXIST);
+
+    int fds[TM4C_FS_MAX_OPEN];
+    for (int &fd : fds) {
+        fd = tm4c_fs_open("a", O_RDONLY);
+        CHECK(fd >= TM4C_FS_FD_FIRST);
+    }
+    CHECK(tm4c_fs_open("a", O_RDONLY) == -EMFILE);
+    CHECK(tm4c_fs_unlink("a") == -EBUSY);
+    for (int fd : fds) {
+        tm4c_fs_close(fd);
+    }
+
+    // every file id taken
+    for (int i = 2; i < TM4C_FS_MAX_FILES; i++) {
+        CHECK(write_file(("file" + std::to_string(i)).c_str(), "x"));
+    }
+    CHECK(tm4c_fs_open("one too many", O_WRONLY | O_CREAT) == -ENOSPC);
+    CHECK(tm4c_fs_unlink("file2") == 0);
+    CHECK(write_file("one too many", "fits now"));
+}
+
+void test_truncate_and_unlink() {
+    fresh();
+
+    CHECK(write_file("log", "first version"));
+    CHECK(write_file("log", "second"));
+    CHECK(read_file("log") == "second");
+
+    const std::uint32_t programs = flash.programs;
+    const int fd = tm4c_fs_open("log", O_WRONLY | O_TRUNC);
+    tm4c_fs_close(fd);
+    CHECK(read_file("log") == "");
+    // truncating an empty file writes nothing
+    tm4c_fs_close(tm4c_fs_open("log", O_WRONLY | O_TRUNC));
+    CHECK(flash.programs == programs + 3);
+
+    CHECK(tm4c_fs_unlink("log") == 0);
+    CHECK(tm4c_fs_unlink("log") == -ENOENT);
+    CHECK(read_file("log") == "<" + std::to_string(ENOENT) + ">");
+
+    // a new file with the same name does not see the old data
+    CHECK(write_file("log", "", O_CREAT));
+    CHECK(read_file("log") == "");
+}
+
+void test_appends_only_add() {
+    fresh();
+
+    // appends that fit the free blocks never erase and never touch a word twice
+    const std::uint32_t erases = flash.total_erases();
+    std::string expected;
+    const int fd = tm4c_fs_open("samples", O_WRONLY | O_CREAT | O_APPEND);
+
+    for (int i = 0; expected.size() < TM4C_FS_SIZE / 4; i++) {
+        const std::string chunk = pattern(1 + static_cast<std::size_t>(i % 97), static_cast<unsigned>(i));
+
+        CHECK(tm4c_fs_write(fd, chunk.data(), chunk.size()) == static_cast<int>(chunk.size()));
+        expected += chunk;
+    }
+    tm4c_fs_close(fd);
+
+    CHECK(flash.total_erases() == erases);
+    CHECK(flash.reprogrammed == 0);
+    CHECK(read_file("samples") == expected);
+
+    // a single large write spans blocks
+    const std::string large = pattern(2500, 3);
+    CHECK(write_file("large", large, O_CREAT));
+    CHECK(read_file("large") == large);
+    CHECK(flash.reprogrammed == 0);
+}
+
+void test_rewrite_middle() {
+    fresh();
+
+    std::string expected = pattern(1500, 1);
+    CHECK(write_file("data", expected));
+
+    const int fd = tm4c_fs_open("data", O_RDWR);
+    CHECK(tm4c_fs_lseek(fd, 700, SEEK_SET) == 700);
+    CHECK(tm4c_fs_write(fd, "PATCHED", 7) == 7);
+    expected.replace(700, 7, "PATCHED");
+    CHECK(tm4c_fs_lseek(fd, 1495, SEEK_SET) == 1495);
+    CHECK(tm4c_fs_write(fd, "over the end", 12) == 12);
+    expected.replace(1495, 5, "over the end");
+    tm4c_fs_close(fd);
+
+    CHECK(read_file("data") == expected);
+    CHECK(tm4c_fs_mount() == 0);
+    CHECK(read_file("data") == expected);
+    CHECK(flash.reprogrammed == 0);
+}
+
+void test_remount() {
+    fresh();
+
+    CHECK(write_file("one", "1111"));
+    CHECK(write_file("two", pattern(1800, 2)));
+    CHECK(write_file("three", "3"));
+    CHECK(tm4c_fs_unlink("three") == 0);
+    CHECK(write_file("one", "+more", O_APPEND));
+
+    tm4c_fs_stats_t before;
+    CHECK(tm4c_fs_stats(&before) == 0);
+
+    CHECK(tm4c_fs_mount() == 0);
+    CHECK(read_file("one") == "1111+more");
+    CHECK(read_file("two") == pattern(1800, 2));
+    CHECK(read_file("three") == "<" + std::to_string(ENOENT) + ">");
+
+    tm4c_fs_stats_t after;
+    CHECK(tm4c_fs_stats(&after) == 0);
+    CHECK(after.files == 2);
+    CHECK(after.live_bytes == before.live_bytes);
+    CHECK(after.free_bytes == before.free_bytes);
+
+    CHECK(tm4c_fs_format() == 0);
+    CHECK(tm4c_fs_stats(&after) == 0);
+    CHECK(after.files == 0);
+    CHECK(read_file("one") == "<" + std::to_string(ENOENT) + ">");
+}
+
+void test_wear_leveling() {
+    fresh();
+
+    // a file that never changes and one rewritten over and over
+    const std::string still = pattern(2000, 9);
+    CHECK(write_file("static", still));
+
+    for (int cycle = 0; cycle < 3000; cycle++) {
+        CHECK(write_file("counter", pattern(300, static_cast<unsigned>(cycle))));
+    }
+
+    tm4c_fs_stats_t stats;
+    CHECK(tm4c_fs_stats(&stats) == 0);
+    CHECK(stats.files == 2);
+    CHECK(stats.min_erase_count > 50);
+    CHECK(stats.max_erase_count - stats.min_erase_count <= 2);
+
+    CHECK(tm4c_fs_mount() == 0);
+    CHECK(read_file("static") == still);
+    CHECK(read_file("counter") == pattern(300, 2999));
+    CHECK(flash.reprogrammed == 0);
+}
+
+void test_full() {
+    fresh();
+
+    const int fd = tm4c_fs_open("big", O_WRONLY | O_CREAT);
+    const std::string chunk = pattern(500, 5);
+    std::size_t size = 0;
+    int written;
+
+    while ((written = tm4c_fs_write(fd, chunk.data(), chunk.size())) == static_cast<int>(chunk.size())) {
+        size += chunk.size();
+    }
+    if (written > 0) {
+        size += static_cast<std::size_t>(written);
+        CHECK(tm4c_fs_write(fd, chunk.data(), chunk.size()) == -ENOSPC);
+    } else {
+        CHECK(written == -ENOSPC);
+    }
+    tm4c_fs_close(fd);
+
+    CHECK(size > TM4C_FS_SIZE / 2);
+    CHECK(read_file("big").size() == size);
+    CHECK(tm4c_fs_mount() == 0);
+    CHECK(read_file("big").size() == size);
+
+    // deleting the file makes room again
+    CHECK(tm4c_fs_unlink("big") == 0);
+    CHECK(write_file("small", pattern(3000, 6)));
+    CHECK(read_file("small") == pattern(3000, 6));
+}
+
+/**
+ * @brief Cuts the power after every number of flash operations an operation
+ *        takes. After the reset the file has to be in one of the states a cut
+ *        may leave or, once the operation completes, in the final one.
+ */
+template <typename Operation>
+void test_power_cuts(const char *name, Operation operation, std::initializer_list<std::string> cut,
+                     const std::string &after) {
+    const Flash saved = flash;
+
+    for (int budget = 0;; budget++) {
+        flash = saved;
+        CHECK(tm4c_fs_mount() == 0);
+        flash.budget = budget;
+        operation();
+        const bool completed = !flash.off;
+
+        flash.budget = -1;
+        flash.off = false;
+        CHECK(tm4c_fs_mount() == 0);
+
+        const std::string text = read_file(name);
+        CHECK(text == after || std::find(cut.begin(), cut.end(), text) != cut.end());
+        if (completed) {
+            CHECK(text == after);
+        }
+        CHECK(read_file("other") == "untouched");
+
+        // still fully usable
+        CHECK(write_file("probe", pattern(600, static_cast<unsigned>(budget))));
+        CHECK(read_file("probe") == pattern(600, static_cast<unsigned>(budget)));
+        CHECK(read_file(name) == text);
+
+        if (completed) {
+            break;
+        }
+    }
+
+    flash = saved;
+    CHECK(tm4c_fs_mount() == 0);
+}
+
+void test_power_loss() {
+    fresh();
+    const std::string missing = "<" + std::to_string(ENOENT) + ">";
+
+    CHECK(write_file("other", "untouched"));
+    test_power_cuts("new", [] { write_file("new", "created"); }, {missing, ""}, "created");
+
+    CHECK(write_file("file", pattern(1200, 1)));
+    test_power_cuts("file", [] { write_file("file", "appended", O_APPEND); }, {pattern(1200, 1)},
+                    pattern(1200, 1) + "appended");
+    // the open truncates, the write comes after
+    test_power_cuts("file", [] { write_file("file", "truncated"); }, {pattern(1200, 1), ""}, "truncated");
+    test_power_cuts("file", [] { tm4c_fs_unlink("file"); }, {pattern(1200, 1)}, missing);
+
+    std::string patched = pattern(1200, 1);
+    patched.replace(10, 5, "PATCH");
+    test_power_cuts(
+        "file",
+        [] {
+            const int fd = tm4c_fs_open("file", O_WRONLY);
+            tm4c_fs_lseek(fd, 10, SEEK_SET);
+            tm4c_fs_write(fd, "PATCH", 5);
+            tm4c_fs_close(fd);
+        },
+        {pattern(1200, 1)}, patched);
+
+    // cuts while the garbage collector moves the file
+    for (int i = 0; i < 12; i++) {
+        CHECK(write_file("churn", pattern(700, static_cast<unsigned>(i))));
+    }
+    test_power_cuts(
+        "file",
+        [] {
+            for (int i = 0; i < 12; i++) {
+                write_file("churn", pattern(700, static_cast<unsigned>(i)));
+            }
+        },
+        {}, pattern(1200, 1));
+
+    CHECK(flash.reprogrammed == 0);
+}
+
+} // namespace
+
+int main() {
+    test_mount_formats();
+    test_read_write();
+    test_open_errors();
+    test_truncate_and_unlink();
+    test_appends_only_add();
+    test_rewrite_middle();
+    test_remount();
+    test_wear_leveling();
+    test_full();
+    test_power_loss();
+
+    return check::result();
+}
@@ -0,0 +1,206 @@
+/**
+ * @file test_gpio.cpp
+ * @author Esteban Duran (@astroesteban)
+ * @brief Tests the masked-address GPIO pins (tm4c_gpio.hpp) against simulated
+ *        ports that decode the GPIODATA aliases like the chip does.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#include <cstdint>
+#include <map>
+
+#include "check.hpp"
+#include "tm4c_gpio.hpp"
+
+namespace {
+
+using tm4c::gpio::Bus;
+using tm4c::gpio::Pin;
+using tm4c::gpio::PinGroup;
+using tm4c::gpio::Port;
+
+/// Every port's data and other registers as far as tm4c_gpio.hpp sees them
+struct Gpio {
+    std::map<std::uint32_t, std::uint32_t> data;        // by port base
+    std::map<std::uint32_t, std::uint32_t> registers;
+    std::uint32_t loads = 0;
+    std::uint32_t stores = 0;
+    std::uint32_t last_store = 0;
+};
+
+Gpio gpio;
+
+bool is_data(std::uint32_t address) {
+    const bool apb = address >= 0x40004000 && address < 0x40026000;
+    const bool ahb = address >= 0x40058000 && address < 0x4005E000;
+    return (apb || ahb) && (address & 0xFFF) < 0x400;
+}
+
+} // namespace
+
+extern "C" std::uint32_t tm4c_register_sim_read(std::uint32_t address) {
+    gpio.loads++;
+    if (is_data(address)) {
+        return gpio.data[address & ~0xFFFU] & ((address >> 2) & 0xFF);
+    }
+    if (address == 0x400FEA08) {
+        return gpio.registers[0x400FE608];      // PRGPIO follows RCGCGPIO at once
+    }
+    return gpio.registers[address];
+}
+
+extern "C" void tm4c_register_sim_write(std::uint32_t address, std::uint32_t value) {
+    gpio.stores++;
+    gpio.last_store = address;
+    if (is_data(address)) {
+        const std::uint32_t mask = (address >> 2) & 0xFF;
+        std::uint32_t &data = gpio.data[address & ~0xFFFU];
+        data = (data & ~mask) | (value & mask);
+        return;
+    }
+    gpio.registers[address] = value;
+}
+
+namespace {
+
+// the aliases, datasheet section 10.2.1.2
+static_assert(tm4c::gpio::base(Port::A) == 0x40004000);
+static_assert(tm4c::gpio::base(Port::E) == 0x40024000);
+static_assert(Pin<Port::F, 1>::address == 0x40025008);
+static_assert(Pin<Port::F, 0>::address == 0x40025004);
+static_assert(Pin<Port::F, 4>::address == 0x40025040);
+static_assert(Pin<Port::A, 7>::address == 0x40004200);
+static_assert(PinGroup<Port::F, 0x0E>::address == 0x40025038);
+static_assert(PinGroup<Port::F, 0xFF>::address == 0x400253FC);  // GPIO_PORTF_DATA_R
+static_assert(PinGroup<Port::D, 0x81>::address == 0x40007204);
+
+// the AHB aperture, datasheet table 10-6. Without TM4C_GPIO_AHB_PORTS every
+// port stays on the APB
+static_assert(tm4c::gpio::base(Port::A, Bus::AHB) == 0x40058000);
+static_assert(tm4c::gpio::base(Port::F, Bus::AHB) == 0x4005D000);
+static_assert(tm4c::gpio::default_bus(Port::F) == Bus::APB);
+static_assert(Pin<Port::F, 1>::bus == Bus::APB);
+static_assert(Pin<Port::F, 1, Bus::AHB>::address == 0x4005D008);
+static_assert(PinGroup<Port::E, 0xFF, Bus::AHB>::address == 0x4005C3FC);
+static_assert(TM4C_GPIO_BASE(0U) == 0x40004000);
+static_assert(TM4C_GPIO_APB_BASE(5U) == 0x40025000);
+static_assert(TM4C_GPIO_AHB_BASE(3U) == 0x4005B000);
+
+void reset(std::uint32_t port_f) {
+    gpio = Gpio{};
+    gpio.data[0x40025000] = port_f;
+}
+
+void test_stores_touch_only_their_pins() {
+    using Rgb = PinGroup<Port::F, 0x0E>;
+    using Red = Pin<Port::F, 1>;
+    using Blue = Pin<Port::F, 2>;
+
+    reset(0x11);                    // the switches' pull-ups read high
+
+    Rgb::write(0x04);
+    CHECK(gpio.data[0x40025000] == 0x15);
+    Rgb::write(0xFF);               // bits of other pins are ignored
+    CHECK(gpio.data[0x40025000] == 0x1F);
+    Rgb::clear();
+    CHECK(gpio.data[0x40025000] == 0x11);
+
+    Red::set();
+    Blue::write(true);
+    CHECK(gpio.data[0x40025000] == 0x17);
+    Red::write(false);
+    CHECK(gpio.data[0x40025000] == 0x15);
+
+    // every one of them is a single store and nothing is read
+    CHECK(gpio.loads == 0);
+    CHECK(gpio.stores == 6);
+    CHECK(gpio.last_store == 0x40025008);
+}
+
+void test_reads_see_only_their_pins() {
+    using Rgb = PinGroup<Port::F, 0x0E>;
+    using Switch1 = Pin<Port::F, 4>;
+    using Switch2 = Pin<Port::F, 0>;
+    using Red = Pin<Port::F, 1>;
+    using Blue = Pin<Port::F, 2>;
+
+    reset(0x15);
+
+    CHECK(Rgb::read() == 0x04);
+    CHECK(Switch1::is_high());
+    CHECK(Switch2::is_high());
+    CHECK(!Red::is_high());
+    CHECK(Blue::read() == 0x04);
+}
+
+void test_toggle() {
+    reset(0x13);
+
+    Pin<Port::F, 1>::toggle();
+    CHECK(gpio.data[0x40025000] == 0x11);
+    PinGroup<Port::F, 0x06>::toggle();
+    CHECK(gpio.data[0x40025000] == 0x17);
+    CHECK(gpio.loads == 2);
+    CHECK(gpio.stores == 2);
+}
+
+void test_set_up() {
+    reset(0);
+
+    using Switches = PinGroup<Port::F, 0x11>;
+    using Leds = PinGroup<Port::F, 0x0E>;
+
+    Switches::enable();
+    CHECK((gpio.registers[0x400FE608] & 0x20) != 0);
+
+    // PF0 needs the port unlocked first
+    Switches::make_input(tm4c::gpio::Pull::Up);
+    CHECK(gpio.registers[0x40025520] == 0x4C4F434B);
+    CHECK(gpio.registers[0x40025524] == 0x01);
+    CHECK(gpio.registers[0x40025510] == 0x11);
+    CHECK(gpio.registers[0x40025400] == 0x00);
+
+    gpio.registers.erase(0x40025520);
+    Leds::make_output();
+    CHECK(gpio.registers.count(0x40025520) == 0);
+    CHECK(gpio.registers[0x40025400] == 0x0E);
+    CHECK(gpio.registers[0x4002551C] == 0x1F);
+}
+
+void test_ahb() {
+    using Red = Pin<Port::F, 1, Bus::AHB>;
+    using Leds = PinGroup<Port::F, 0x0E, Bus::AHB>;
+
+    gpio = Gpio{};
+    gpio.registers[0x400FE06C] = 0x01;
+
+    Red::use_bus();
+    CHECK(gpio.registers[0x400FE06C] == 0x21);  // GPIOHBCTL, port A stays
+
+    Leds::make_output();
+    CHECK(gpio.registers[0x4005D400] == 0x0E);
+    CHECK(gpio.registers[0x4005D51C] == 0x0E);
+
+    Red::set();
+    CHECK(gpio.data[0x4005D000] == 0x02);
+    CHECK(gpio.last_store == 0x4005D008);
+    CHECK(Red::is_high());
+
+    Pin<Port::F, 1, Bus::APB>::use_bus();
+    CHECK(gpio.registers[0x400FE06C] == 0x01);
+}
+
+} // namespace
+
+int main() {
+    test_stores_touch_only_their_pins();
+    test_reads_see_only_their_pins();
+    test_toggle();
+    test_set_up();
+    test_ahb();
+
+    return check::result();
+}
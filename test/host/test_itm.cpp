@@ -0,0 +1,159 @@
+/**
+ * @file test_itm.cpp
+ * @author Esteban Duran (@astroesteban)
+ * @brief Tests the ITM stimulus port output (itm.c) against a simulated ITM
+ *        whose FIFO needs a few polls to take the next packet.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "check.hpp"
+#include "tm4c_itm.h"
+
+namespace {
+
+constexpr std::uint32_t STIM = 0xE0000000;
+constexpr std::uint32_t TER = 0xE0000E00;
+constexpr std::uint32_t TCR = 0xE0000E80;
+
+struct Packet {
+    std::uint32_t port;
+    std::size_t width;
+    std::uint32_t value;
+
+    bool operator==(const Packet &) const = default;
+};
+
+/// The ITM as far as itm.c sees it
+struct Itm {
+    std::map<std::uint32_t, std::uint32_t> registers;
+    std::vector<Packet> packets;
+    std::uint32_t busy_polls = 0;       // polls until the FIFO takes the next packet
+    std::uint32_t packet_polls = 0;     // busy polls every packet causes
+    std::uint32_t lost = 0;             // writes while the FIFO was full
+
+    void enable(std::uint32_t ports) {
+        registers[TCR] = 1;
+        registers[TER] = ports;
+    }
+
+    void reset() {
+        *this = Itm{};
+    }
+};
+
+Itm itm;
+
+} // namespace
+
+extern "C" std::uint32_t tm4c_itm_sim_read(std::uint32_t address) {
+    if (address >= STIM && address < STIM + 32 * 4) {
+        if (itm.busy_polls > 0) {
+            itm.busy_polls--;
+            return 0;
+        }
+        return 1;
+    }
+    return itm.registers[address];
+}
+
+extern "C" void tm4c_itm_sim_write(std::uint32_t address, std::uint32_t value, std::size_t width) {
+    if (address >= STIM && address < STIM + 32 * 4) {
+        if (itm.busy_polls > 0) {
+            itm.lost++;
+            return;
+        }
+        itm.packets.push_back({(address - STIM) / 4, width, value});
+        itm.busy_polls = itm.packet_polls;
+        return;
+    }
+    itm.registers[address] = value;
+}
+
+namespace {
+
+void test_disabled_ports_are_skipped() {
+    itm.reset();
+    CHECK(tm4c_itm_write(TM4C_ITM_PORT_TEXT, "hello", 5) == 5);
+    CHECK(itm.packets.empty());
+
+    // the ITM is on but the debugger does not capture port 0
+    itm.enable(1u << TM4C_ITM_PORT_LOG);
+    CHECK(tm4c_itm_write(TM4C_ITM_PORT_TEXT, "hello", 5) == 5);
+    CHECK(itm.packets.empty());
+
+    // there is no port 32, 1 << 32 does not test a bit of TER
+    itm.enable(0xFFFFFFFF);
+    CHECK(tm4c_itm_write(TM4C_ITM_PORTS, "hello", 5) == 0);
+    CHECK(itm.packets.empty());
+}
+
+void test_block_packs_words() {
+    itm.reset();
+    itm.enable(0xFFFFFFFF);
+    itm.packet_polls = 3;
+    tm4c_itm_set_policy(TM4C_ITM_BLOCK);
+    const std::uint32_t dropped = tm4c_itm_dropped();
+
+    CHECK(tm4c_itm_write(TM4C_ITM_PORT_TEXT, "abcdefghij", 10) == 10);
+
+    const std::vector<Packet> expected{
+        {0, 4, 0x64636261}, {0, 4, 0x68676665}, {0, 1, 'i'}, {0, 1, 'j'}};
+    CHECK(itm.packets == expected);
+    CHECK(itm.lost == 0);
+    CHECK(tm4c_itm_dropped() == dropped);
+}
+
+void test_drop_never_waits() {
+    itm.reset();
+    itm.enable(0xFFFFFFFF);
+    itm.packet_polls = 3;
+    tm4c_itm_set_policy(TM4C_ITM_DROP);
+    const std::uint32_t dropped = tm4c_itm_dropped();
+
+    CHECK(tm4c_itm_write(TM4C_ITM_PORT_TEXT, "abcdefghij", 10) == 4);
+    CHECK(itm.packets.size() == 1);
+    CHECK(itm.lost == 0);
+    CHECK(tm4c_itm_dropped() - dropped == 6);
+
+    // once the FIFO drained the next write goes through again
+    itm.busy_polls = 0;
+    CHECK(tm4c_itm_write(TM4C_ITM_PORT_TEXT, "k", 1) == 1);
+    CHECK(itm.packets.back() == (Packet{0, 1, 'k'}));
+    tm4c_itm_set_policy(TM4C_ITM_BLOCK);
+}
+
+void test_counters_and_log() {
+    itm.reset();
+    itm.enable(0xFFFFFFFF);
+
+    tm4c_itm_counter(0, 1234);
+    tm4c_itm_counter(5, 0xDEADBEEF);
+    tm4c_itm_counter(TM4C_ITM_COUNTERS, 1);
+    const std::uint32_t record[2] = {0xA5000000, 42};
+    CHECK(tm4c_itm_log_sink(record, sizeof(record)) == sizeof(record));
+
+    const std::vector<Packet> expected{{8, 4, 1234},
+                                       {13, 4, 0xDEADBEEF},
+                                       {TM4C_ITM_PORT_LOG, 4, 0xA5000000},
+                                       {TM4C_ITM_PORT_LOG, 4, 42}};
+    CHECK(itm.packets == expected);
+}
+
+} // namespace
+
+int main() {
+    test_disabled_ports_are_skipped();
+    test_block_packs_words();
+    test_drop_never_waits();
+    test_counters_and_log();
+
+    return check::result();
+}
@@ -0,0 +1,191 @@
+/**
+ * @file test_lock.cpp
+ * @author Esteban Duran (@astroesteban)
+ * @brief Tests the BASEPRI based newlib locks (lock.c) against simulated
+ *        BASEPRI, IPSR and cycle counter registers.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#include <cstdint>
+#include <vector>
+
+#include "check.hpp"
+#include "tm4c_lock.h"
+
+struct __lock;
+using _LOCK_T = __lock *;
+
+extern "C" {
+extern __lock __lock___malloc_recursive_mutex;
+extern __lock __lock___sfp_recursive_mutex;
+
+void __retarget_lock_init_recursive(_LOCK_T *lock);
+void __retarget_lock_close_recursive(_LOCK_T lock);
+void __retarget_lock_acquire_recursive(_LOCK_T lock);
+void __retarget_lock_release_recursive(_LOCK_T lock);
+int __retarget_lock_try_acquire(_LOCK_T lock);
+void __retarget_lock_release(_LOCK_T lock);
+void __malloc_lock(struct _reent *reent);
+void __malloc_unlock(struct _reent *reent);
+}
+
+namespace {
+
+std::uint32_t basepri = 0;
+std::uint32_t ipsr = 0;
+std::uint32_t cycles = 0;
+
+} // namespace
+
+extern "C" std::uint32_t tm4c_lock_sim_basepri() {
+    return basepri;
+}
+
+extern "C" void tm4c_lock_sim_set_basepri(std::uint32_t value) {
+    basepri = value;
+}
+
+extern "C" std::uint32_t tm4c_lock_sim_ipsr() {
+    return ipsr;
+}
+
+extern "C" std::uint32_t tm4c_lock_sim_cycles() {
+    return cycles;
+}
+
+namespace {
+
+void test_masks_up_to_the_lock_priority() {
+    static_assert(TM4C_LIBC_LOCK_BASEPRI == (TM4C_LIBC_LOCK_PRIORITY << 5));
+
+    __malloc_lock(nullptr);
+    CHECK(basepri == TM4C_LIBC_LOCK_BASEPRI);
+    __malloc_unlock(nullptr);
+    CHECK(basepri == 0);
+}
+
+void test_recursion_restores_on_the_outermost_release() {
+    __retarget_lock_acquire_recursive(&__lock___sfp_recursive_mutex);
+    __malloc_lock(nullptr);
+    __malloc_lock(nullptr);
+    __malloc_unlock(nullptr);
+    __malloc_unlock(nullptr);
+    CHECK(basepri == TM4C_LIBC_LOCK_BASEPRI);
+    __retarget_lock_release_recursive(&__lock___sfp_recursive_mutex);
+    CHECK(basepri == 0);
+
+    // a release too many must not unmask anything
+    __retarget_lock_release_recursive(&__lock___sfp_recursive_mutex);
+    CHECK(basepri == 0);
+}
+
+void test_out_of_order_release() {
+    // what _fclose_r does: FILE lock, sfp lock, FILE unlock, sfp unlock
+    _LOCK_T file = nullptr;
+    __retarget_lock_init_recursive(&file);
+
+    __retarget_lock_acquire_recursive(file);
+    __retarget_lock_acquire_recursive(&__lock___sfp_recursive_mutex);
+    __retarget_lock_release_recursive(file);
+    CHECK(basepri == TM4C_LIBC_LOCK_BASEPRI);   // the sfp lock is still held
+    __retarget_lock_release_recursive(&__lock___sfp_recursive_mutex);
+    CHECK(basepri == 0);
+
+    // the same with a stricter BASEPRI around it
+    basepri = 1 << 5;
+    __retarget_lock_acquire_recursive(file);
+    __malloc_lock(nullptr);
+    __retarget_lock_release_recursive(file);
+    __malloc_unlock(nullptr);
+    CHECK(basepri == 1 << 5);
+    basepri = 0;
+
+    __retarget_lock_close_recursive(file);
+}
+
+void test_keeps_a_stricter_basepri() {
+    // an application critical section that masks more than the locks
+    basepri = 1 << 5;
+    __malloc_lock(nullptr);
+    CHECK(basepri == 1 << 5);
+    __malloc_unlock(nullptr);
+    CHECK(basepri == 1 << 5);
+
+    // one that masks less is raised and then restored
+    basepri = 6 << 5;
+    __malloc_lock(nullptr);
+    CHECK(basepri == TM4C_LIBC_LOCK_BASEPRI);
+    __malloc_unlock(nullptr);
+    CHECK(basepri == 6 << 5);
+    basepri = 0;
+}
+
+void test_runtime_locks() {
+    std::vector<_LOCK_T> locks(TM4C_LIBC_LOCKS + 2);
+
+    for (auto &lock : locks) {
+        __retarget_lock_init_recursive(&lock);
+    }
+    // the pool hands out distinct locks, the rest share one
+    for (int i = 0; i < TM4C_LIBC_LOCKS; i++) {
+        CHECK(locks[i] != locks[TM4C_LIBC_LOCKS]);
+        CHECK(i == 0 || locks[i] != locks[i - 1]);
+    }
+    CHECK(locks[TM4C_LIBC_LOCKS] == locks[TM4C_LIBC_LOCKS + 1]);
+
+    CHECK(__retarget_lock_try_acquire(locks[3]) == 0);
+    CHECK(basepri == TM4C_LIBC_LOCK_BASEPRI);
+    __retarget_lock_release(locks[3]);
+    CHECK(basepri == 0);
+
+    // a closed lock goes back to the pool
+    const _LOCK_T closed = locks[2];
+    __retarget_lock_close_recursive(closed);
+    _LOCK_T reused = nullptr;
+    __retarget_lock_init_recursive(&reused);
+    CHECK(reused == closed);
+
+    for (auto &lock : locks) {
+        __retarget_lock_close_recursive(lock);
+    }
+}
+
+void test_debug_statistics() {
+    const tm4c_lock_stats_t before = tm4c_lock_stats();
+
+    cycles = 100;
+    __malloc_lock(nullptr);
+    cycles = 150;
+    __malloc_lock(nullptr);
+    __malloc_unlock(nullptr);
+
+    // an interrupt above the lock priority uses malloc in the middle
+    ipsr = 16 + 5;
+    __malloc_lock(nullptr);
+    __malloc_unlock(nullptr);
+    ipsr = 0;
+
+    cycles = 100 + 5000;
+    __malloc_unlock(nullptr);
+
+    const tm4c_lock_stats_t after = tm4c_lock_stats();
+    CHECK(after.acquisitions - before.acquisitions == 1);
+    CHECK(after.contentions - before.contentions == 1);
+    CHECK(after.max_hold_cycles == 5000);
+}
+
+} // namespace
+
+int main() {
+    test_masks_up_to_the_lock_priority();
+    test_recursion_restores_on_the_outermost_release();
+    test_out_of_order_release();
+    test_keeps_a_stricter_basepri();
+    test_runtime_locks();
+    test_debug_statistics();
+
+    return check::result();
+}
@@ -0,0 +1,133 @@
+/**
+ * @file test_log.cpp
+ * @author Esteban Duran (@astroesteban)
+ * @brief Tests the record encoding and the ring of the deferred binary log
+ *        (log.c).
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "check.hpp"
+#include "tm4c_log.h"
+
+extern "C" void log_from_c(const char *name, float ratio, double scale, int value,
+                           unsigned char byte);
+
+namespace {
+
+std::vector<std::uint32_t> drained;
+
+std::size_t sink(const void *data, std::size_t size) {
+    CHECK(size % 4 == 0);
+    const std::size_t first = drained.size();
+    drained.resize(first + size / 4);
+    std::memcpy(&drained[first], data, size);
+    return size;
+}
+
+std::vector<std::uint32_t> drain() {
+    drained.clear();
+    const std::size_t bytes = tm4c_log_drain(sink);
+    CHECK(bytes == drained.size() * 4);
+    return drained;
+}
+
+std::uint32_t count_of(std::uint32_t header) {
+    return (header >> 20) & 0xF;
+}
+
+void test_encoding() {
+    const char *const name = "adc";
+
+    TM4C_LOG("%s: %d mV, %u, %f %f %c", name, -5, 7u, 1.5f, 2.25, 'x');
+    const auto words = drain();
+
+    CHECK(words.size() == 2 + 6);
+    CHECK(words[0] >> 24 == TM4C_LOG_MARKER);
+    CHECK(count_of(words[0]) == 6);
+    CHECK(words[2] == static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(name)));
+    CHECK(words[3] == static_cast<std::uint32_t>(-5));
+    CHECK(words[4] == 7);
+    CHECK(words[5] == std::bit_cast<std::uint32_t>(1.5f));
+    CHECK(words[6] == std::bit_cast<std::uint32_t>(2.25f));
+    CHECK(words[7] == 'x');
+}
+
+void test_no_arguments() {
+    TM4C_LOG("first");
+    TM4C_LOG("second");
+    const auto words = drain();
+
+    CHECK(words.size() == 4);
+    CHECK(count_of(words[0]) == 0 && count_of(words[2]) == 0);
+    // different strings, different IDs, and the timestamps move on
+    CHECK((words[0] & 0xFFFFF) != (words[2] & 0xFFFFF));
+    CHECK(words[3] - words[1] == 1);
+}
+
+void test_c_encoding() {
+    const char *const name = "c";
+
+    log_from_c(name, 0.5f, -3.0, -1, 200);
+    const auto words = drain();
+
+    CHECK(words.size() == 2 + 5);
+    CHECK(count_of(words[0]) == 5);
+    CHECK(words[2] == static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(name)));
+    CHECK(words[3] == std::bit_cast<std::uint32_t>(0.5f));
+    CHECK(words[4] == std::bit_cast<std::uint32_t>(-3.0f));
+    CHECK(words[5] == 0xFFFFFFFF);
+    CHECK(words[6] == 200);
+}
+
+void test_drain_wraps() {
+    // 5 words per record against a 16 word ring puts records across the end
+    for (std::uint32_t i = 0; i < 10; i++) {
+        TM4C_LOG("%u %u %u", i, i + 1, i + 2);
+        TM4C_LOG("%u", i);
+        const auto words = drain();
+
+        CHECK(words.size() == 8);
+        CHECK(count_of(words[0]) == 3);
+        CHECK(words[2] == i && words[3] == i + 1 && words[4] == i + 2);
+        CHECK(count_of(words[5]) == 1);
+        CHECK(words[7] == i);
+    }
+}
+
+void test_full_ring_drops() {
+    const std::uint32_t dropped = tm4c_log.dropped;
+
+    // 4 words each, the fifth does not fit into 16 words any more
+    for (std::uint32_t i = 0; i < 5; i++) {
+        TM4C_LOG("%u %u", i, i);
+    }
+    CHECK(tm4c_log.dropped - dropped == 1);
+
+    const auto words = drain();
+    CHECK(words.size() == 16);
+    CHECK(words[14] == 3);
+
+    TM4C_LOG("%u %u", 4u, 4u);
+    CHECK(drain().size() == 4);
+    CHECK(tm4c_log.dropped - dropped == 1);
+}
+
+} // namespace
+
+int main() {
+    test_encoding();
+    test_no_arguments();
+    test_c_encoding();
+    test_drain_wraps();
+    test_full_ring_drops();
+
+    return check::result();
+}
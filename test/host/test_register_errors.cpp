@@ -0,0 +1,64 @@
+/**
+ * @file test_register_errors.cpp
+ * @author Esteban Duran (@astroesteban)
+ * @brief Register and bit-band accesses that must not compile, one per REGISTER_ERROR
+ *        case. CMake builds each case and expects the build to fail. Only
+ *        built, the addresses do not exist on the host.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#include <cstdint>
+
+#include "tm4c_bitband.hpp"
+#include "tm4c_register.hpp"
+
+namespace {
+
+using Control = tm4c::Register<0x40000000>;
+using Status = tm4c::Register<0x40000004, tm4c::Access::ReadOnly>;
+using Command = tm4c::Register<0x40000008, tm4c::Access::WriteOnly>;
+
+enum class Mode : std::uint32_t { Off, Slow, Fast };
+
+constexpr tm4c::Field<0, 4> COUNT;
+constexpr tm4c::Field<4, 2, Mode> MODE;
+constexpr tm4c::Field<6, 1, bool> ENABLE;
+
+// what the cases rely on
+static_assert(COUNT(5) == tm4c::FieldSet{0x0F, 0x05});
+static_assert((COUNT(5) | MODE(Mode::Fast) | ENABLE(true)) == tm4c::FieldSet{0x7F, 0x65});
+static_assert(MODE.extract(0x65) == Mode::Fast);
+static_assert(tm4c::Field<0, 32>::mask == 0xFFFFFFFFU);
+static_assert(tm4c::Field<31, 1>::mask == 0x80000000U);
+
+} // namespace
+
+int main() {
+#if REGISTER_ERROR == 0
+    // the well-formed baseline, proves the other cases fail for their error
+    Control::modify<COUNT(15), MODE(Mode::Slow)>();
+    Command::write(ENABLE(true));
+    tm4c::bitband::FieldBit<Control, ENABLE>::set();
+    return static_cast<int>(Status::read() + Control::get(COUNT));
+#elif REGISTER_ERROR == 1
+    Control::modify<COUNT(16)>();
+#elif REGISTER_ERROR == 2
+    Control::modify<COUNT(1), tm4c::Field<3, 2>{}(1)>();
+#elif REGISTER_ERROR == 3
+    return static_cast<int>(Command::read());
+#elif REGISTER_ERROR == 4
+    Status::write(1);
+#elif REGISTER_ERROR == 5
+    Command::modify(ENABLE(true));
+#elif REGISTER_ERROR == 6
+    constexpr tm4c::Field<30, 4> too_wide;
+#elif REGISTER_ERROR == 7
+    tm4c::bitband::FieldBit<Command, ENABLE>::set();    // the bus would read it
+#elif REGISTER_ERROR == 8
+    tm4c::bitband::FieldBit<Control, MODE>::set();
+#endif
+    return 0;
+}
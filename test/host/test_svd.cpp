@@ -0,0 +1,52 @@
+/**
+ * @file test_svd.cpp
+ * @author Esteban Duran (@astroesteban)
+ * @brief Checks the headers utils/svd_to_cpp.py generates against addresses
+ *        and field encodings from the datasheet. Everything is checked at
+ *        compile time, all.hpp makes every header compile.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#include <type_traits>
+
+#include "tm4c_svd/all.hpp"
+
+namespace {
+
+using namespace tm4c::svd;
+
+// peripherals with the same layout share the template
+static_assert(std::is_same_v<GPIOF, gpio::Peripheral<0x40025000>>);
+static_assert(GPIOF_AHB::base == 0x4005D000);
+static_assert(UART7::base == 0x40013000);
+
+static_assert(GPIOF::DATA::address == 0x400253FC);
+static_assert(GPIOF::DEN::address == 0x4002551C);
+static_assert(GPIOF::LOCK::address == 0x40025520);
+static_assert(GPIOF::CR::access == tm4c::Access::ReadWrite);
+static_assert(GPIOF::ICR::access == tm4c::Access::WriteOnly);
+static_assert(SYSCTL::RCGCGPIO::address == 0x400FE608);
+static_assert(SYSCTL::RCC::address == 0x400FE060);
+static_assert(UART0::DR::address == 0x4000C000);
+static_assert(EEPROM::EERDWRINC::address == 0x400AF014);
+
+// fields lose the SVD's GROUP_REGISTER_ prefix, values the field's
+static_assert(SYSCTL::RCC::XTAL.mask == 0x000007C0);
+static_assert(SYSCTL::RCC::SYSDIV.mask == 0x07800000);
+static_assert(SYSCTL::RCC::XTAL(SYSCTL::RCC::XTAL_Value::_16MHZ).value == 0x00000540);
+static_assert(SYSCTL::RCC::OSCSRC(SYSCTL::RCC::OSCSRC_Value::INT4).value == 0x00000020);
+static_assert(SYSCTL::RCGCGPIO::R5(true).value == 0x20);
+static_assert(static_cast<std::uint32_t>(GPIOF::LOCK::VALUE_Value::KEY) == 0x4C4F434B);
+static_assert(UART0::FR::TXFF.mask == 0x20);
+
+// registers in an alternate group keep their own name
+static_assert(I2C0::MCS::address == I2C0::MCS_ALT::address);
+
+} // namespace
+
+int main() {
+    return 0;
+}
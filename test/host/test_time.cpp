@@ -0,0 +1,158 @@
+/**
+ * @file test_time.cpp
+ * @author Esteban Duran (@astroesteban)
+ * @brief Tests the 64-bit time base (time.c) against a simulated wide timer
+ *        that moves on with every register access.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#include <chrono>
+#include <cstdint>
+
+#include "check.hpp"
+#include "tm4c_time.hpp"
+
+namespace {
+
+/// The wide timer clock gating, the timer is ready as soon as it is clocked
+struct SystemControl {
+    volatile std::uint32_t rcgcwtimer = 0;
+    volatile std::uint32_t prwtimer = 0;
+
+    volatile std::uint32_t *access(std::uint32_t offset) {
+        prwtimer = rcgcwtimer;
+        return offset == 0xA5C ? &prwtimer : &rcgcwtimer;
+    }
+
+    bool clocked() const { return (rcgcwtimer & (1U << 5)) != 0; }
+};
+
+SystemControl sysctl;
+
+/// Wide timer 5 in 64-bit up counting mode
+struct WideTimer {
+    volatile std::uint32_t registers[0x100]{};
+    std::uint64_t counter = 0;
+    std::uint64_t step = 0;             // cycles every register access takes
+    std::uint32_t gated_accesses = 0;   // bus faults on the real part
+
+    volatile std::uint32_t *access(std::uint32_t offset) {
+        if (!sysctl.clocked()) {
+            gated_accesses++;
+        }
+        // the value registers show the counter at the time of the access
+        registers[0x050 / 4] = static_cast<std::uint32_t>(counter);
+        registers[0x054 / 4] = static_cast<std::uint32_t>(counter >> 32);
+        counter += step;
+        return &registers[offset / 4];
+    }
+};
+
+WideTimer timer;
+
+} // namespace
+
+extern "C" volatile std::uint32_t *tm4c_time_sim_register(std::uint32_t offset) {
+    return timer.access(offset);
+}
+
+extern "C" volatile std::uint32_t *tm4c_time_sim_sysctl(std::uint32_t offset) {
+    return sysctl.access(offset);
+}
+
+namespace {
+
+void test_init() {
+    // left running by a debugger session, but the clock was gated by a reset
+    timer.registers[0x00C / 4] = 0x1;
+    tm4c_time_init();
+
+    CHECK(sysctl.clocked());
+    CHECK(timer.gated_accesses == 0);
+    CHECK(timer.registers[0x000 / 4] == 0x0);         // 64-bit
+    CHECK(timer.registers[0x004 / 4] == 0x12);        // periodic, counting up
+    CHECK(timer.registers[0x028 / 4] == 0xFFFFFFFF);
+    CHECK(timer.registers[0x02C / 4] == 0xFFFFFFFF);
+    CHECK(timer.registers[0x00C / 4] == 0x1);
+
+    // running already, nothing is touched again
+    timer.registers[0x004 / 4] = 0;
+    tm4c_time_init();
+    CHECK(timer.registers[0x004 / 4] == 0);
+    CHECK(timer.gated_accesses == 0);
+}
+
+void test_reads_are_never_torn() {
+    // start the reads at every position around the wrap of the lower half
+    for (std::uint64_t start = 0x1FFFFFFE0; start < 0x200000020; start++) {
+        timer.counter = start;
+        timer.step = 7;
+
+        const std::uint64_t ticks = tm4c_time_ticks();
+        CHECK(ticks >= start && ticks <= timer.counter);
+    }
+    timer.step = 0;
+}
+
+void test_conversions() {
+    // 2^40 cycles are hours, far beyond where ticks * 10^9 overflows
+    timer.counter = std::uint64_t{1} << 40;
+    const std::uint64_t seconds = timer.counter / TM4C_TIME_HZ;
+    const std::uint64_t ns = tm4c_time_ns();
+    CHECK(ns / 1'000'000'000U == seconds);
+    CHECK(ns == seconds * 1'000'000'000U +
+                    (timer.counter % TM4C_TIME_HZ) * 1'000'000'000U / TM4C_TIME_HZ);
+
+    timespec now{};
+    CHECK(tm4c_time_get(CLOCK_MONOTONIC, &now) == 0);
+    CHECK(static_cast<std::uint64_t>(now.tv_sec) == seconds);
+    CHECK(static_cast<std::uint64_t>(now.tv_nsec) == ns % 1'000'000'000U);
+    CHECK(tm4c_time_get(CLOCK_PROCESS_CPUTIME_ID, &now) == -1);
+}
+
+void test_realtime() {
+    timer.counter = 5ULL * TM4C_TIME_HZ;
+    timespec now{};
+
+    // starts at the epoch
+    CHECK(tm4c_time_get(CLOCK_REALTIME, &now) == 0);
+    CHECK(now.tv_sec == 5 && now.tv_nsec == 0);
+
+    const timespec wall{1'800'000'000, 250'000'000};
+    tm4c_time_set_realtime(&wall);
+    timer.counter += 2ULL * TM4C_TIME_HZ;
+
+    CHECK(tm4c_time_get(CLOCK_REALTIME, &now) == 0);
+    CHECK(now.tv_sec == 1'800'000'002 && now.tv_nsec == 250'000'000);
+    CHECK(tm4c_time_get(CLOCK_MONOTONIC, &now) == 0);
+    CHECK(now.tv_sec == 7);
+}
+
+void test_chrono_clock() {
+    static_assert(tm4c::Clock::is_steady);
+
+    timer.counter = 1000;
+    const auto start = tm4c::Clock::now();
+    timer.counter += TM4C_TIME_HZ / 1000;
+    const auto elapsed = tm4c::Clock::now() - start;
+
+    CHECK(elapsed == tm4c::Cycles{TM4C_TIME_HZ / 1000});
+    CHECK(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count() == 1000);
+}
+
+} // namespace
+
+int main() {
+    test_init();
+    test_reads_are_never_torn();
+    test_conversions();
+    test_realtime();
+    test_chrono_clock();
+
+    CHECK(timer.gated_accesses == 0);
+
+    return check::result();
+}
@@ -0,0 +1,302 @@
+/**
+ * @file test_uart.cpp
+ * @author Esteban Duran (@astroesteban)
+ * @brief Tests the rings and the interrupt-driven UART0 driver (uart.c)
+ *        against the simulated register block.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#include <cstdint>
+#include <string>
+
+#include "check.hpp"
+#include "tm4c_ring.h"
+#include "tm4c_uart.h"
+#include "uart_sim.hpp"
+
+namespace {
+
+/// Bytes 'a' + i % 26 for i in [first, first + count)
+std::string pattern(std::size_t first, std::size_t count) {
+    std::string text;
+    for (std::size_t i = first; i < first + count; i++) {
+        text.push_back(static_cast<char>('a' + i % 26));
+    }
+    return text;
+}
+
+void test_ring_wraps() {
+    std::uint8_t storage[8];
+    tm4c_ring_t ring = TM4C_RING_INIT(storage);
+    std::uint8_t out[8];
+
+    // run the indices around the buffer a few times
+    for (int i = 0; i < 5; i++) {
+        CHECK(tm4c_ring_write(&ring, "abcde", 5) == 5);
+        CHECK(tm4c_ring_used(&ring) == 5);
+        CHECK(tm4c_ring_read(&ring, out, 8) == 5);
+        CHECK(std::string(reinterpret_cast<char *>(out), 5) == "abcde");
+    }
+
+    CHECK(tm4c_ring_write(&ring, "0123456789", 10) == 8);
+    CHECK(tm4c_ring_free(&ring) == 0);
+    CHECK(tm4c_ring_put(&ring, 'x') == 0);
+
+    // the data starts at index 25 % 8 = 1, so it wraps after 7 bytes
+    const std::uint8_t *span;
+    CHECK(tm4c_ring_span(&ring, &span) == 7);
+    CHECK(span[0] == '0');
+    tm4c_ring_skip(&ring, 7);
+    CHECK(tm4c_ring_span(&ring, &span) == 1);
+    CHECK(span[0] == '7');
+
+    std::uint8_t byte;
+    CHECK(tm4c_ring_get(&ring, &byte) == 1 && byte == '7');
+    CHECK(tm4c_ring_get(&ring, &byte) == 0);
+}
+
+void test_write_returns_before_sending() {
+    tm4c_uart0_set_policy(TM4C_UART_BLOCK);
+    sim::uart0.sent.clear();
+
+    const std::string text = pattern(0, 40);
+    CHECK(tm4c_uart0_write(text.data(), text.size()) == text.size());
+
+    // the writer only primed the FIFO, the interrupt does the rest
+    CHECK(sim::uart0.sent.size() < 2);
+    CHECK(sim::uart0.tx_fifo.size() >= sim::Uart::fifo_depth - 1);
+
+    sim::uart0.run_until_idle();
+    CHECK(sim::uart0.sent == text);
+    CHECK(sim::uart0.overruns == 0);
+}
+
+void test_block_waits_for_space() {
+    tm4c_uart0_set_policy(TM4C_UART_BLOCK);
+    sim::uart0.sent.clear();
+    const std::uint32_t dropped = tm4c_uart0_dropped();
+
+    // much more than the 64 byte ring, the writer has to feed the FIFO
+    const std::string text = pattern(0, 300);
+    CHECK(tm4c_uart0_write(text.data(), text.size()) == text.size());
+
+    sim::uart0.run_until_idle();
+    CHECK(sim::uart0.sent == text);
+    CHECK(tm4c_uart0_dropped() == dropped);
+    CHECK(sim::uart0.overruns == 0);
+}
+
+void test_drop_newest() {
+    tm4c_uart0_set_policy(TM4C_UART_DROP_NEWEST);
+    sim::uart0.sent.clear();
+    const std::uint32_t dropped = tm4c_uart0_dropped();
+
+    const std::string text = pattern(0, 100);
+    CHECK(tm4c_uart0_write(text.data(), text.size()) == 64);
+    CHECK(tm4c_uart0_dropped() - dropped == 36);
+
+    sim::uart0.run_until_idle();
+    CHECK(sim::uart0.sent == pattern(0, 64));
+}
+
+void test_drop_oldest() {
+    tm4c_uart0_set_policy(TM4C_UART_DROP_OLDEST);
+    sim::uart0.sent.clear();
+    std::uint32_t dropped = tm4c_uart0_dropped();
+
+    std::string text = pattern(0, 100);
+    CHECK(tm4c_uart0_write(text.data(), text.size()) == text.size());
+    CHECK(tm4c_uart0_dropped() - dropped == 36);
+
+    sim::uart0.run_until_idle();
+    CHECK(sim::uart0.sent == pattern(36, 64));
+
+    // more than the whole ring in one go keeps only the tail of the write
+    sim::uart0.sent.clear();
+    dropped = tm4c_uart0_dropped();
+    text = pattern(0, 200);
+    CHECK(tm4c_uart0_write(text.data(), text.size()) == text.size());
+    CHECK(tm4c_uart0_dropped() - dropped == 136);
+
+    sim::uart0.run_until_idle();
+    CHECK(sim::uart0.sent == pattern(136, 64));
+}
+
+void test_interleaved_writes() {
+    tm4c_uart0_set_policy(TM4C_UART_BLOCK);
+    sim::uart0.sent.clear();
+
+    // small writes while the interrupt keeps draining the ring
+    std::string expected;
+    for (std::size_t i = 0; i < 50; i++) {
+        const std::string text = pattern(i, 1 + i % 13);
+        expected += text;
+        tm4c_uart0_write(text.data(), text.size());
+        for (int tick = 0; tick < 3; tick++) {
+            sim::uart0.shift_out();
+            sim::uart0.service();
+        }
+    }
+
+    sim::uart0.run_until_idle();
+    CHECK(sim::uart0.sent == expected);
+    CHECK(sim::uart0.overruns == 0);
+}
+
+void test_flush() {
+    tm4c_uart0_set_policy(TM4C_UART_BLOCK);
+    sim::uart0.sent.clear();
+
+    tm4c_uart0_write("flushed", 7);
+    tm4c_uart0_flush();
+    CHECK(sim::uart0.sent == "flushed");
+    CHECK(sim::uart0.tx_fifo.empty());
+}
+
+/// Lets the transmitter finish and forgets what it sent
+void drain_tx() {
+    sim::uart0.run_until_idle();
+    sim::uart0.sent.clear();
+}
+
+void test_rx_raw() {
+    tm4c_uart0_set_mode(TM4C_UART_RAW);
+    const std::string packet("\x01\x02\x00\r\nbinary", 11);
+
+    // more than the FIFO trigger level raises the RX interrupt right away
+    sim::uart0.receive(packet);
+    sim::uart0.service();
+
+    CHECK(tm4c_uart0_available() == packet.size());
+    char buffer[32];
+    CHECK(tm4c_uart0_read_some(buffer, 4) == 4);
+    CHECK(tm4c_uart0_read_some(buffer + 4, sizeof(buffer)) == packet.size() - 4);
+    CHECK(std::string(buffer, packet.size()) == packet);
+    CHECK(tm4c_uart0_read_some(buffer, sizeof(buffer)) == 0);
+}
+
+void test_rx_timeout_batches() {
+    tm4c_uart0_set_mode(TM4C_UART_RAW);
+    sim::uart0.isr_calls = 0;
+
+    // below the trigger level the bytes wait for the receive timeout
+    sim::uart0.receive("12345");
+    sim::uart0.service();
+    CHECK(tm4c_uart0_available() == 0);
+    CHECK(sim::uart0.isr_calls == 0);
+
+    sim::uart0.rx_timeout();
+    sim::uart0.service();
+    CHECK(sim::uart0.isr_calls == 1);
+
+    char buffer[8];
+    CHECK(tm4c_uart0_read(buffer, sizeof(buffer)) == 5);
+    CHECK(std::string(buffer, 5) == "12345");
+}
+
+void test_rx_cooked() {
+    tm4c_uart0_set_mode(TM4C_UART_COOKED);
+    tm4c_uart0_set_policy(TM4C_UART_BLOCK);
+    drain_tx();
+
+    sim::uart0.receive("helo\bl");
+    sim::uart0.rx_timeout();
+    sim::uart0.service();
+    CHECK(tm4c_uart0_available() == 0);
+
+    // CR LF ends the line once
+    sim::uart0.receive("o\r\nnext");
+    sim::uart0.rx_timeout();
+    sim::uart0.service();
+    CHECK(tm4c_uart0_available() == 6);
+
+    char buffer[16];
+    CHECK(tm4c_uart0_read_some(buffer, 3) == 3);
+    CHECK(tm4c_uart0_read_some(buffer + 3, sizeof(buffer)) == 3);
+    CHECK(std::string(buffer, 6) == "hello\n");
+
+    // the next line is not complete yet
+    CHECK(tm4c_uart0_available() == 0);
+    sim::uart0.receive("\x7f\x7ft\n");
+    sim::uart0.rx_timeout();
+    sim::uart0.service();
+    CHECK(tm4c_uart0_read(buffer, sizeof(buffer)) == 4);
+    CHECK(std::string(buffer, 4) == "net\n");
+
+    sim::uart0.run_until_idle();
+    CHECK(sim::uart0.sent == "helo\b \blo\r\nnext\b \b\b \bt\r\n");
+}
+
+void test_echo_never_blocks() {
+    tm4c_uart0_set_mode(TM4C_UART_COOKED);
+    tm4c_uart0_set_policy(TM4C_UART_BLOCK);
+    drain_tx();
+
+    // the transmitter stalls with the FIFO and the ring full
+    const std::uint32_t ticks_per_byte = sim::uart0.ticks_per_byte;
+    sim::uart0.ticks_per_byte = UINT32_MAX;
+    const std::string text = pattern(0, 64 + sim::Uart::fifo_depth);
+    CHECK(tm4c_uart0_write(text.data(), text.size()) == text.size());
+    const std::uint32_t dropped = tm4c_uart0_dropped();
+
+    // the echo is dropped instead of waiting, the line is still read
+    sim::uart0.receive("ok\r");
+    sim::uart0.rx_timeout();
+    sim::uart0.service();
+    CHECK(tm4c_uart0_available() == 3);
+    CHECK(tm4c_uart0_dropped() - dropped == 4);
+
+    char buffer[4];
+    CHECK(tm4c_uart0_read_some(buffer, sizeof(buffer)) == 3);
+    CHECK(std::string(buffer, 3) == "ok\n");
+
+    sim::uart0.ticks_per_byte = ticks_per_byte;
+    sim::uart0.run_until_idle();
+    CHECK(sim::uart0.sent == text);
+}
+
+void test_rx_lost() {
+    tm4c_uart0_set_mode(TM4C_UART_RAW);
+    const std::uint32_t lost = tm4c_uart0_rx_lost();
+
+    // nobody reads, the 256 byte ring overflows
+    for (std::size_t i = 0; i < 20; i++) {
+        sim::uart0.receive(pattern(16 * i, 16));
+        sim::uart0.service();
+    }
+    CHECK(tm4c_uart0_rx_lost() - lost == 20 * 16 - TM4C_STDIO_RX_BUFFER);
+
+    char buffer[TM4C_STDIO_RX_BUFFER];
+    CHECK(tm4c_uart0_read_some(buffer, sizeof(buffer)) == TM4C_STDIO_RX_BUFFER);
+    CHECK(std::string(buffer, sizeof(buffer)) == pattern(0, TM4C_STDIO_RX_BUFFER));
+
+    // bytes lost in the hardware FIFO count as well
+    sim::uart0.receive(pattern(0, 20));
+    sim::uart0.service();
+    CHECK(tm4c_uart0_rx_lost() - lost == 20 * 16 - TM4C_STDIO_RX_BUFFER + 1);
+    CHECK(tm4c_uart0_read_some(buffer, sizeof(buffer)) == 16);
+}
+
+} // namespace
+
+int main() {
+    sim::uart0.reset();
+
+    test_ring_wraps();
+    test_write_returns_before_sending();
+    test_block_waits_for_space();
+    test_drop_newest();
+    test_drop_oldest();
+    test_interleaved_writes();
+    test_flush();
+    test_rx_raw();
+    test_rx_timeout_batches();
+    test_rx_cooked();
+    test_echo_never_blocks();
+    test_rx_lost();
+
+    return check::result();
+}
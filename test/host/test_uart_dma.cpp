@@ -0,0 +1,150 @@
+/**
+ * @file test_uart_dma.cpp
+ * @author Esteban Duran (@astroesteban)
+ * @brief Tests the uDMA path of the UART0 driver (uart.c, udma.c) against
+ *        the simulated UART and uDMA controller.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#include <cstdint>
+#include <string>
+
+#include "check.hpp"
+#include "tm4c_udma.h"
+#include "tm4c_uart.h"
+#include "udma_sim.hpp"
+#include "uart_sim.hpp"
+
+namespace {
+
+// the table has room for the alternate structures other code may use
+static_assert(sizeof(tm4c_udma_table) / sizeof(tm4c_udma_table[0]) == 2 * TM4C_UDMA_CHANNELS);
+
+/// Bytes 'a' + i % 26 for i in [first, first + count)
+std::string pattern(std::size_t first, std::size_t count) {
+    std::string text;
+    for (std::size_t i = first; i < first + count; i++) {
+        text.push_back(static_cast<char>('a' + i % 26));
+    }
+    return text;
+}
+
+/// Clears what the previous test left in the simulation counters
+void start() {
+    tm4c_uart0_set_policy(TM4C_UART_BLOCK);
+    sim::uart0.sent.clear();
+    sim::uart0.isr_calls = 0;
+    sim::udma.transfers = 0;
+}
+
+void test_small_writes_use_the_fifo() {
+    start();
+
+    tm4c_uart0_write("short", 5);
+    sim::uart0.run_until_idle();
+
+    CHECK(sim::uart0.sent == "short");
+    CHECK(sim::udma.transfers == 0);
+}
+
+void test_bulk_writes_use_the_dma() {
+    start();
+
+    const std::string text = pattern(0, 200);
+    tm4c_uart0_write(text.data(), text.size());
+    sim::uart0.run_until_idle();
+
+    CHECK(sim::uart0.sent == text);
+    CHECK(sim::udma.transfers >= 1);
+    // the interrupt path would have needed one every 8 bytes
+    CHECK(sim::uart0.isr_calls <= 4);
+    CHECK(sim::uart0.overruns == 0);
+}
+
+void test_async_is_zero_copy_and_ordered() {
+    start();
+
+    static std::string telemetry = pattern(3, 3000);
+    static bool done = false;
+    done = false;
+
+    tm4c_uart0_write("head", 4);
+    CHECK(tm4c_uart0_write_async(telemetry.data(), telemetry.size(),
+                                 [](void *flag) { *static_cast<bool *>(flag) = true; },
+                                 &done) == 0);
+    tm4c_uart0_write("tail", 4);
+
+    // a second request has to wait for the first one
+    CHECK(tm4c_uart0_write_async("x", 1, nullptr, nullptr) == -1);
+
+    // run until the controller streams from the caller's buffer
+    bool in_place = false;
+    for (int i = 0; i < 200 && !in_place; i++) {
+        sim::uart0.shift_out();
+        sim::uart0.service();
+        const auto *end = static_cast<const volatile char *>(
+            tm4c_udma_table[TM4C_UDMA_CH_UART0_TX].source_end);
+        in_place = end >= telemetry.data() && end < telemetry.data() + telemetry.size();
+    }
+    CHECK(in_place);
+    CHECK(!done);
+
+    sim::uart0.run_until_idle();
+    CHECK(done);
+    CHECK(sim::uart0.sent == "head" + telemetry + "tail");
+    // 1 KB per transfer
+    CHECK(sim::udma.transfers == 3);
+    CHECK(sim::uart0.overruns == 0);
+}
+
+void test_drop_oldest_stops_the_transfer() {
+    start();
+    tm4c_uart0_set_policy(TM4C_UART_DROP_OLDEST);
+    const std::uint32_t dropped = tm4c_uart0_dropped();
+
+    const std::string first = pattern(0, 200);
+    const std::string second = pattern(200, 200);
+    tm4c_uart0_write(first.data(), first.size());
+    for (int i = 0; i < 20; i++) {
+        sim::uart0.shift_out();
+        sim::uart0.service();
+    }
+    tm4c_uart0_write(second.data(), second.size());
+    sim::uart0.run_until_idle();
+
+    // nothing is sent twice and the newest bytes all made it
+    const std::string &sent = sim::uart0.sent;
+    CHECK(sent.size() + (tm4c_uart0_dropped() - dropped) == first.size() + second.size());
+    CHECK(sent.size() >= second.size() &&
+          sent.compare(sent.size() - second.size(), second.size(), second) == 0);
+    CHECK(sim::uart0.overruns == 0);
+}
+
+void test_flush_waits_for_the_dma() {
+    start();
+
+    static const std::string text = pattern(7, 500);
+    tm4c_uart0_write_async(text.data(), text.size(), nullptr, nullptr);
+    tm4c_uart0_flush();
+
+    CHECK(sim::uart0.sent == text);
+    CHECK(sim::uart0.tx_fifo.empty());
+}
+
+} // namespace
+
+int main() {
+    sim::udma.reset();
+    sim::uart0.reset();
+
+    test_small_writes_use_the_fifo();
+    test_bulk_writes_use_the_dma();
+    test_async_is_zero_copy_and_ordered();
+    test_drop_oldest_stops_the_transfer();
+    test_flush_waits_for_the_dma();
+
+    return check::result();
+}
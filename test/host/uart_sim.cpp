@@ -0,0 +1,171 @@
+/**
+ * @file uart_sim.cpp
+ * @author Esteban Duran (@astroesteban)
+ * @brief The simulated UART0 register block, see uart_sim.hpp.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#include "uart_sim.hpp"
+
+#include <tuple>
+#include <utility>
+
+namespace {
+
+constexpr std::uint32_t DR = 0x000;
+constexpr std::uint32_t FR = 0x018;
+constexpr std::uint32_t IFLS = 0x034;
+constexpr std::uint32_t IM = 0x038;
+constexpr std::uint32_t RIS = 0x03C;
+constexpr std::uint32_t MIS = 0x040;
+constexpr std::uint32_t ICR = 0x044;
+
+constexpr std::uint32_t DR_OE = 1U << 11;
+constexpr std::uint32_t FR_BUSY = 1U << 3;
+constexpr std::uint32_t FR_RXFE = 1U << 4;
+constexpr std::uint32_t FR_TXFF = 1U << 5;
+constexpr std::uint32_t FR_RXFF = 1U << 6;
+constexpr std::uint32_t FR_TXFE = 1U << 7;
+constexpr std::uint32_t INT_RX = 1U << 4;
+constexpr std::uint32_t INT_TX = 1U << 5;
+constexpr std::uint32_t INT_RT = 1U << 6;
+
+constexpr std::uint32_t no_access = 0xFFFFFFFF;
+
+/// FIFO level the TX interrupt triggers at for the IFLS TXIFLSEL values
+constexpr std::size_t tx_trigger[] = {2, 4, 8, 12, 14};
+
+/// FIFO level the RX interrupt triggers at for the IFLS RXIFLSEL values
+constexpr std::size_t rx_trigger[] = {2, 4, 8, 12, 14};
+
+} // namespace
+
+namespace sim {
+
+Uart uart0;
+
+void Uart::reset() {
+    auto hooks = std::make_pair(on_sync, irq_pending);
+    *this = Uart{};
+    std::tie(on_sync, irq_pending) = hooks;
+    regs[DR / 4] = mark;
+    regs[IFLS / 4] = 0x12;
+    sync();
+}
+
+void Uart::sync() {
+    std::uint32_t &dr = regs[DR / 4];
+    std::uint32_t &icr = regs[ICR / 4];
+
+    if ((dr & mark) == 0) {
+        if (tx_fifo.size() < fifo_depth) {
+            tx_fifo.push_back(static_cast<std::uint8_t>(dr));
+        } else {
+            overruns++;
+        }
+        last_access = no_access;
+    }
+    dr = mark | (rx_fifo.empty() ? 0 : rx_fifo.front()) | (rx_overrun ? DR_OE : 0);
+
+    regs[RIS / 4] &= ~icr;
+    icr = 0;
+
+    if (on_sync) {
+        on_sync(*this);
+    }
+
+    regs[FR / 4] = (tx_fifo.size() == fifo_depth ? FR_TXFF : 0) |
+                   (tx_fifo.empty() ? FR_TXFE : FR_BUSY) |
+                   (rx_fifo.size() == fifo_depth ? FR_RXFF : 0) |
+                   (rx_fifo.empty() ? FR_RXFE : 0);
+    regs[MIS / 4] = regs[RIS / 4] & regs[IM / 4];
+}
+
+void Uart::access(std::uint32_t offset) {
+    // a DR access that did not store anything was a read
+    if (last_access == DR && (regs[DR / 4] & mark) != 0 && !rx_fifo.empty()) {
+        rx_fifo.pop_front();
+        rx_overrun = false;
+    }
+    last_access = offset;
+    tick();
+}
+
+void Uart::receive(const std::string &bytes) {
+    const std::size_t trigger = rx_trigger[(regs[IFLS / 4] >> 3 & 0x7) % 5];
+
+    for (const char byte : bytes) {
+        if (rx_fifo.size() == fifo_depth) {
+            rx_overrun = true;
+            continue;
+        }
+
+        rx_fifo.push_back(static_cast<std::uint8_t>(byte));
+        if (rx_fifo.size() == trigger) {
+            regs[RIS / 4] |= INT_RX;
+        }
+    }
+    sync();
+}
+
+void Uart::rx_timeout() {
+    if (!rx_fifo.empty()) {
+        regs[RIS / 4] |= INT_RT;
+    }
+    sync();
+}
+
+void Uart::tick() {
+    sync();
+    if (++ticks % ticks_per_byte == 0) {
+        shift_out();
+    }
+}
+
+bool Uart::interrupted() const {
+    return reg(MIS) != 0 || (irq_pending && irq_pending());
+}
+
+void Uart::shift_out() {
+    if (tx_fifo.empty()) {
+        return;
+    }
+
+    const std::size_t trigger = tx_trigger[(regs[IFLS / 4] & 0x7) % 5];
+    const std::size_t level = tx_fifo.size();
+
+    sent.push_back(static_cast<char>(tx_fifo.front()));
+    tx_fifo.pop_front();
+
+    if (level > trigger && tx_fifo.size() <= trigger) {
+        regs[RIS / 4] |= INT_TX;
+    }
+    sync();
+}
+
+void Uart::service() {
+    sync();
+    while (interrupted()) {
+        isr_calls++;
+        UART0_ISR();
+        sync();
+    }
+}
+
+void Uart::run_until_idle() {
+    service();
+    while (!tx_fifo.empty()) {
+        shift_out();
+        service();
+    }
+}
+
+} // namespace sim
+
+extern "C" volatile std::uint32_t *tm4c_uart_sim_register(std::uint32_t offset) {
+    sim::uart0.access(offset);
+    return &sim::uart0.regs[offset / 4];
+}
@@ -0,0 +1,90 @@
+/**
+ * @file uart_sim.hpp
+ * @author Esteban Duran (@astroesteban)
+ * @brief A simulated UART0 register block for testing uart.c on the host.
+ *
+ * @details uart.c built with TM4C_UART_SIMULATED calls
+ *          tm4c_uart_sim_register() for every register access. A write is
+ *          only a store to the returned word, so the simulation applies the
+ *          side effects of the previous access (a byte written to DR, bits
+ *          written to ICR, a byte read from DR) at the start of the next
+ *          one. DR is presented with bit 31 set, a store always clears it,
+ *          so a DR access that left bit 31 alone was a read. Every access also
+ *          advances time, the transmitter shifts one byte out of the FIFO
+ *          every `ticks_per_byte` accesses, which lets busy waits progress.
+ *          Other simulated blocks (udma_sim.hpp) hook into on_sync.
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <string>
+
+namespace sim {
+
+struct Uart {
+    static constexpr std::size_t fifo_depth = 16;
+    static constexpr std::uint32_t mark = 1U << 31;
+
+    std::uint32_t regs[0x1000 / 4]{};
+    std::deque<std::uint8_t> tx_fifo;
+    std::deque<std::uint8_t> rx_fifo;
+    bool rx_overrun = false;    // the RX FIFO overflowed before the next byte
+    std::string sent;           // bytes that left the transmitter
+    std::uint32_t overruns = 0; // bytes written to DR while the FIFO was full
+    std::uint32_t isr_calls = 0;  // times UART0_ISR was entered
+    std::uint32_t ticks = 0;
+    std::uint32_t last_access = 0xFFFFFFFF;
+    std::uint32_t ticks_per_byte = 64;
+
+    /// Other simulated blocks attached to the UART (the uDMA)
+    std::function<void(Uart &)> on_sync;
+    std::function<bool()> irq_pending;
+
+    /// Back to the reset state, with nothing sent
+    void reset();
+
+    /// Applies the pending side effects and updates the flags
+    void sync();
+
+    /// The driver accesses a register
+    void access(std::uint32_t offset);
+
+    /// Bytes arriving on the RX line
+    void receive(const std::string &bytes);
+
+    /// The RX line stayed idle for 32 bit periods
+    void rx_timeout();
+
+    /// A bus access, time passes
+    void tick();
+
+    /// Shifts one byte out of the TX FIFO
+    void shift_out();
+
+    /// Calls UART0_ISR while an unmasked interrupt is pending
+    void service();
+
+    /// Lets the transmitter run until the FIFO and the driver are idle
+    void run_until_idle();
+
+    /// Whether UART0_ISR would be entered
+    bool interrupted() const;
+
+    std::uint32_t reg(std::uint32_t offset) const { return regs[offset / 4]; }
+};
+
+/// The register block uart.c sees
+extern Uart uart0;
+
+} // namespace sim
+
+extern "C" void UART0_ISR(void);
@@ -0,0 +1,99 @@
+/**
+ * @file udma_sim.cpp
+ * @author Esteban Duran (@astroesteban)
+ * @brief The simulated micro DMA controller, see udma_sim.hpp.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#include "udma_sim.hpp"
+
+#include "tm4c_udma.h"
+
+namespace {
+
+constexpr std::uint32_t ENASET = 0x028;
+constexpr std::uint32_t ENACLR = 0x02C;
+constexpr std::uint32_t CHIS = 0x504;
+constexpr std::uint32_t mark = 1U << 31;
+
+constexpr std::uint32_t UART_DMACTL = 0x048;
+constexpr std::uint32_t UART_DMACTL_TXDMAE = 1U << 1;
+constexpr std::size_t uart_burst = 8;
+
+} // namespace
+
+namespace sim {
+
+Udma udma;
+
+void Udma::reset() {
+    *this = Udma{};
+    sync();
+    uart0.on_sync = [](Uart &uart) { udma.feed(uart); };
+    uart0.irq_pending = [] {
+        return (udma.interrupts & (1U << TM4C_UDMA_CH_UART0_TX)) != 0;
+    };
+}
+
+void Udma::sync() {
+    std::uint32_t &set = regs[ENASET / 4];
+    std::uint32_t &clear = regs[ENACLR / 4];
+    std::uint32_t &status = regs[CHIS / 4];
+
+    if ((set & mark) == 0) {
+        enabled |= set;
+    }
+    if ((clear & mark) == 0) {
+        enabled &= ~clear;
+    }
+    if ((status & mark) == 0) {
+        interrupts &= ~status;
+    }
+
+    set = enabled | mark;
+    clear = mark;
+    status = interrupts | mark;
+}
+
+void Udma::feed(Uart &uart) {
+    constexpr std::uint32_t channel = 1U << TM4C_UDMA_CH_UART0_TX;
+    volatile tm4c_udma_control_t &entry = tm4c_udma_table[TM4C_UDMA_CH_UART0_TX];
+
+    sync();
+    if ((enabled & channel) == 0 || (uart.reg(UART_DMACTL) & UART_DMACTL_TXDMAE) == 0 ||
+        uart.tx_fifo.size() > Uart::fifo_depth / 2) {
+        return;
+    }
+
+    std::uint32_t control = entry.control;
+    std::uint32_t items = ((control >> 4) & 0x3FF) + 1;
+    const auto *end = static_cast<const volatile std::uint8_t *>(entry.source_end);
+
+    for (std::size_t i = 0; i < uart_burst && items > 0; i++, items--) {
+        const std::uint8_t byte = end[1 - static_cast<std::ptrdiff_t>(items)];
+        uart.tx_fifo.push_back(byte);
+    }
+
+    control &= ~(0x3FFU << 4);
+    if (items == 0) {
+        control &= ~0x7U;
+        enabled &= ~channel;
+        interrupts |= channel;
+        transfers++;
+    } else {
+        control |= (items - 1) << 4;
+    }
+    entry.control = control;
+    sync();
+}
+
+} // namespace sim
+
+extern "C" volatile std::uint32_t *tm4c_udma_sim_register(std::uint32_t offset) {
+    sim::udma.sync();
+    sim::uart0.tick();
+    return &sim::udma.regs[offset / 4];
+}
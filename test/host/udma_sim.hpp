@@ -0,0 +1,49 @@
+/**
+ * @file udma_sim.hpp
+ * @author Esteban Duran (@astroesteban)
+ * @brief A simulated micro DMA controller for testing udma.c and the DMA
+ *        path of uart.c on the host.
+ *
+ * @details udma.c built with TM4C_UDMA_SIMULATED calls
+ *          tm4c_udma_sim_register() for every register access. The set,
+ *          clear and write-1-to-clear registers are presented with bit 31
+ *          set (a channel the board library never uses), so a write always
+ *          changes the word and is noticed at the next access. Only the
+ *          UART0 TX channel moves data: it refills the UART FIFO in bursts
+ *          of 8 whenever the FIFO is at or below half full, like the UART's
+ *          burst request does.
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#pragma once
+
+#include <cstdint>
+
+#include "uart_sim.hpp"
+
+namespace sim {
+
+struct Udma {
+    std::uint32_t regs[0x1000 / 4]{};
+    std::uint32_t enabled = 0;      // channels that are enabled
+    std::uint32_t interrupts = 0;   // channels with a completion pending
+    std::uint32_t transfers = 0;    // transfers that completed
+
+    /// Back to the reset state and attached to uart0
+    void reset();
+
+    /// Applies the pending writes
+    void sync();
+
+    /// Moves bytes of the UART0 TX channel into the FIFO
+    void feed(Uart &uart);
+};
+
+/// The controller udma.c sees
+extern Udma udma;
+
+} // namespace sim
@@ -0,0 +1,27 @@
+/**
+ * @file monolithic.cpp
+ * @author Esteban Duran (@astroesteban)
+ * @brief init_port_f() of the switches example and a clock setup with the
+ *        10k-line lm4f120h5qr.h, the baseline of utils/include_cost.py.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#include "lm4f120h5qr.h"
+
+void init_port_f() {
+    SYSCTL_RCGCGPIO_R |= SYSCTL_RCGCGPIO_R5;
+    GPIO_PORTF_LOCK_R = 0x4C4F434B;
+    GPIO_PORTF_CR_R |= 0x1F;
+    GPIO_PORTF_DIR_R |= 0x0E;
+    GPIO_PORTF_AFSEL_R = 0x00;
+    GPIO_PORTF_PUR_R |= 0x11;
+    GPIO_PORTF_DEN_R |= 0x1F;
+}
+
+void init_clock() {
+    SYSCTL_RCC_R = (SYSCTL_RCC_R & ~(SYSCTL_RCC_XTAL_M | SYSCTL_RCC_OSCSRC_M)) |
+                   SYSCTL_RCC_XTAL_16MHZ | SYSCTL_RCC_OSCSRC_MAIN;
+}
@@ -0,0 +1,31 @@
+/**
+ * @file per_peripheral.cpp
+ * @author Esteban Duran (@astroesteban)
+ * @brief The accesses of monolithic.cpp with only the generated headers of
+ *        the peripherals they touch.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Apache License
+ *
+ */
+#include "tm4c_svd/gpio.hpp"
+#include "tm4c_svd/sysctl.hpp"
+
+using tm4c::svd::GPIOF;
+using tm4c::svd::SYSCTL;
+
+void init_port_f() {
+    SYSCTL::RCGCGPIO::modify(SYSCTL::RCGCGPIO::R5(true));
+    GPIOF::LOCK::write(GPIOF::LOCK::VALUE(GPIOF::LOCK::VALUE_Value::KEY));
+    GPIOF::CR::set(0x1F);
+    GPIOF::DIR::set(0x0E);
+    GPIOF::AFSEL::write(0x00);
+    GPIOF::PUR::set(0x11);
+    GPIOF::DEN::set(0x1F);
+}
+
+void init_clock() {
+    using RCC = SYSCTL::RCC;
+    RCC::modify(RCC::XTAL(RCC::XTAL_Value::_16MHZ) | RCC::OSCSRC(RCC::OSCSRC_Value::MAIN));
+}
@@ -9,24 +9,23 @@
  */
 #include <cstdint>
 
+#include "tm4c_clock.hpp"
+#include "tm4c_register.hpp"
+
 // Wrap everything in an anonymous namespace so that the compiler optimizes
 // this away
 namespace {
-    volatile uint32_t &memory(const uint32_t loc) {
-        return *reinterpret_cast<uint32_t*>(loc);
-    }
-
     // Registers
-    static constexpr uint32_t GPIO_PORTF_DATA_R = 0x400253FC;
-    static constexpr uint32_t GPIO_PORTF_DIR_R = 0x40025400;
-    static constexpr uint32_t GPIO_PORTF_AFSEL_R = 0x40025420;
-    static constexpr uint32_t GPIO_PORTF_PUR_R = 0x40025510;
-    static constexpr uint32_t GPIO_PORTF_DEN_R = 0x4002551C;
-    static constexpr uint32_t GPIO_PORTF_LOCK_R = 0x40025520;
-    static constexpr uint32_t GPIO_PORTF_CR_R = 0x40025524;
-    static constexpr uint32_t GPIO_PORTF_AMSEL_R = 0x40025528;
-    static constexpr uint32_t GPIO_PORTF_PCTL_R = 0x4002552C;
-    static constexpr uint32_t SYSCTL_RCGC2_R = 0x400FE108;
+    using GPIO_PORTF_DATA_R = tm4c::Register<0x400253FC>;
+    using GPIO_PORTF_DIR_R = tm4c::Register<0x40025400>;
+    using GPIO_PORTF_AFSEL_R = tm4c::Register<0x40025420>;
+    using GPIO_PORTF_PUR_R = tm4c::Register<0x40025510>;
+    using GPIO_PORTF_DEN_R = tm4c::Register<0x4002551C>;
+    using GPIO_PORTF_LOCK_R = tm4c::Register<0x40025520>;
+    using GPIO_PORTF_CR_R = tm4c::Register<0x40025524>;
+    using GPIO_PORTF_AMSEL_R = tm4c::Register<0x40025528>;
+    using GPIO_PORTF_PCTL_R = tm4c::Register<0x4002552C>;
+    using SYSCTL_RCGC2_R = tm4c::Register<0x400FE108>;
 
     // The onboard LED colors
     static constexpr uint32_t LED_OFF = 0;
@@ -45,16 +44,16 @@ namespace {
  */
 void portFInit() {
     volatile uint32_t delay; // Give clock enough time to stabilize
-    memory(SYSCTL_RCGC2_R) |= 0x00000020; // 1) F clock
-    delay = SYSCTL_RCGC2_R; // delay
-    memory(GPIO_PORTF_LOCK_R) = 0x4C4F434B; // 2) unlock PortF PF0
-    memory(GPIO_PORTF_CR_R) = 0x1F; // allow changes to PF4-0
-    memory(GPIO_PORTF_AMSEL_R) = 0x00; // 3) disable analog function
-    memory(GPIO_PORTF_PCTL_R) = 0x00000000; // 4) GPIO clear bit PCTL
-    memory(GPIO_PORTF_DIR_R) = 0x0E; // 5) PF4,PF0 input, PF3,PF2,PF1 output
-    memory(GPIO_PORTF_AFSEL_R) = 0x00; // 6) no alternate function
-    memory(GPIO_PORTF_PUR_R) = 0x11; // enable pullup resistors on PF4,PF0
-    memory(GPIO_PORTF_DEN_R) = 0x1F; // 7) enable digital pins PF4-PF0
+    SYSCTL_RCGC2_R::set(0x00000020); // 1) F clock
+    delay = SYSCTL_RCGC2_R::read(); // delay
+    GPIO_PORTF_LOCK_R::write(0x4C4F434B); // 2) unlock PortF PF0
+    GPIO_PORTF_CR_R::write(0x1F); // allow changes to PF4-0
+    GPIO_PORTF_AMSEL_R::write(0x00); // 3) disable analog function
+    GPIO_PORTF_PCTL_R::write(0x00000000); // 4) GPIO clear bit PCTL
+    GPIO_PORTF_DIR_R::write(0x0E); // 5) PF4,PF0 input, PF3,PF2,PF1 output
+    GPIO_PORTF_AFSEL_R::write(0x00); // 6) no alternate function
+    GPIO_PORTF_PUR_R::write(0x11); // enable pullup resistors on PF4,PF0
+    GPIO_PORTF_DEN_R::write(0x1F); // 7) enable digital pins PF4-PF0
 }
 
 
@@ -63,8 +62,11 @@ void portFInit() {
  * 
  */
 void delay() {
+    // The volatile count down below takes roughly 5 cycles per iteration
+    static constexpr uint32_t CYCLES_PER_ITERATION = 5;
+
     // 0.1sec
-    volatile uint32_t time = (727240 * 200) / 91;
+    volatile uint32_t time = tm4c::clock::core_hz / 10 / CYCLES_PER_ITERATION;
 
     while (time > 0) {
         time--;
@@ -82,11 +84,11 @@ int main() {
     portFInit();
 
     while (true) {
-        memory(GPIO_PORTF_DATA_R) = LED_RED;
+        GPIO_PORTF_DATA_R::write(LED_RED);
         delay();
-        memory(GPIO_PORTF_DATA_R) = LED_WHITE;
+        GPIO_PORTF_DATA_R::write(LED_WHITE);
         delay();
-        memory(GPIO_PORTF_DATA_R) = LED_BLUE;
+        GPIO_PORTF_DATA_R::write(LED_BLUE);
         delay();
     }
 }
@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+"""
+file name:
+    compare_codegen.py
+
+details:
+    compares the disassembly of pairs of functions in an object file, e.g.
+    register accesses written with the lm4f120h5qr.h macros against the same
+    accesses written with tm4c_register.hpp. `--same a:b` requires both
+    functions to have identical instructions, `--not-larger a:b` requires b
+    to have no more instructions than a. Addresses and symbol annotations
+    are ignored.
+
+example:
+    $ ./compare_codegen.py --objdump arm-none-eabi-objdump register_codegen.o \
+          --same raw_init_port_f:reg_init_port_f \
+          --not-larger raw_rcc_fields:reg_rcc_fields
+        raw_init_port_f          22  reg_init_port_f          22  same
+        raw_rcc_fields           19  reg_rcc_fields            9  not larger
+
+author(s):
+    @astroesteban
+"""
+import argparse
+import re
+import subprocess
+import sys
+
+FUNCTION = re.compile(r"^[0-9a-f]+ <([^>]+)>:$")
+INSTRUCTION = re.compile(r"^\s+[0-9a-f]+:\s+(.*)$")
+
+
+def disassemble(objdump, path):
+    """Returns {function name: [normalized instructions]}"""
+    output = subprocess.run([objdump, "-d", "--no-show-raw-insn", path],
+                            check=True, capture_output=True, text=True).stdout
+    functions = {}
+    current = None
+    for line in output.splitlines():
+        if match := FUNCTION.match(line):
+            current = functions.setdefault(match.group(1), [])
+        elif current is not None and (match := INSTRUCTION.match(line)):
+            # drop symbol annotations and comments, they name the function
+            text = re.sub(r"\s*(<[^>]*>|[#;@].*)$", "", match.group(1))
+            current.append(" ".join(text.split()))
+    # alignment padding after the last instruction is not part of the function
+    for instructions in functions.values():
+        while instructions and instructions[-1].split()[0] in ("nop", "nopl", "nopw", "xchg"):
+            instructions.pop()
+    return functions
+
+
+def pair(text):
+    first, _, second = text.partition(":")
+    if not first or not second:
+        raise argparse.ArgumentTypeError(f"expected a:b, got {text}")
+    return first, second
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("object", help="the object file holding the functions")
+    parser.add_argument("--objdump", default="objdump", help="the objdump of the toolchain")
+    parser.add_argument("--same", type=pair, action="append", default=[],
+                        help="a:b, both must compile to the same instructions")
+    parser.add_argument("--not-larger", type=pair, action="append", default=[],
+                        help="a:b, b must not have more instructions than a")
+    args = parser.parse_args()
+
+    functions = disassemble(args.objdump, args.object)
+
+    failures = 0
+    checks = [(a, b, "same") for a, b in args.same] + \
+             [(a, b, "not larger") for a, b in args.not_larger]
+    for a, b, relation in checks:
+        if a not in functions or b not in functions:
+            missing = a if a not in functions else b
+            print(f"error: {missing} is not in {args.object}", file=sys.stderr)
+            failures += 1
+            continue
+        if relation == "same":
+            ok = functions[a] == functions[b]
+        else:
+            ok = len(functions[b]) <= len(functions[a])
+        print(f"  {a:<24} {len(functions[a]):3}  {b:<24} {len(functions[b]):3}  "
+              f"{relation if ok else 'FAILED ' + relation}")
+        if not ok:
+            failures += 1
+            for name in (a, b):
+                print(f"    {name}:", *functions[name], sep="\n      ", file=sys.stderr)
+
+    return 1 if failures else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,157 @@
+#!/usr/bin/env python3
+"""
+file name:
+    decode_crash.py
+
+details:
+    decodes the crash record fault.c leaves in .persistent SRAM after a
+    fault (see boards/ek-tm4c123gxl/include/tm4c_fault.h). The dump is
+    either the record alone or a raw dump of SRAM starting at --base, the
+    record is located through the tm4c_crash_record symbol of the ELF.
+    Addresses are resolved to functions and source lines with addr2line if
+    it is installed, otherwise with the symbol table of the ELF.
+
+example:
+    (gdb) dump binary value crash.bin tm4c_crash_record
+    $ ./decode_crash.py blinky.elf crash.bin
+        Crash #1: HardFault (vector 3)
+          pc   0x000004d2  main at blinky.cpp:42
+          lr   0x000004b5  main at blinky.cpp:40
+          ...
+          HFSR 0x40000000  FORCED
+          CFSR 0x00008200  PRECISERR BFARVALID
+          BFAR 0xdeadbeef
+
+author(s):
+    @astroesteban
+"""
+import argparse
+import shutil
+import struct
+import subprocess
+import sys
+import zlib
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).resolve().parent))
+from elf32 import Elf32  # noqa: E402
+
+MAGIC = 0x43524153
+VERSION = 1
+STACK_WORDS = 16
+
+FIELDS = ("magic", "version", "count", "vector", "r0", "r1", "r2", "r3", "r12",
+          "lr", "pc", "xpsr", "exc_return", "sp", "cfsr", "hfsr", "mmfar", "bfar")
+RECORD = struct.Struct(f"<{len(FIELDS) + STACK_WORDS + 1}I")
+
+EXCEPTIONS = {2: "NMI", 3: "HardFault", 4: "MemManage", 5: "BusFault",
+              6: "UsageFault", 11: "SVCall", 12: "DebugMonitor", 14: "PendSV",
+              15: "SysTick"}
+
+CFSR_BITS = {
+    0: "IACCVIOL", 1: "DACCVIOL", 3: "MUNSTKERR", 4: "MSTKERR", 5: "MLSPERR",
+    7: "MMARVALID",
+    8: "IBUSERR", 9: "PRECISERR", 10: "IMPRECISERR", 11: "UNSTKERR",
+    12: "STKERR", 13: "LSPERR", 15: "BFARVALID",
+    16: "UNDEFINSTR", 17: "INVSTATE", 18: "INVPC", 19: "NOCP",
+    24: "UNALIGNED", 25: "DIVBYZERO",
+}
+
+HFSR_BITS = {1: "VECTTBL", 30: "FORCED", 31: "DEBUGEVT"}
+
+FLASH_END = 0x00040000
+
+
+def flags(value, names):
+    return " ".join(name for bit, name in sorted(names.items()) if value & (1 << bit))
+
+
+class Symbolizer:
+    """Resolves code addresses to `function at file:line`."""
+
+    def __init__(self, elf_path, elf):
+        self.elf = elf
+        self.tool = [shutil.which("arm-none-eabi-addr2line"), "-f", "-C", "-e", elf_path]
+
+    def __call__(self, address):
+        if address >= FLASH_END:
+            return ""
+        if self.tool[0] is not None:
+            result = subprocess.run(self.tool + [f"0x{address & ~1:x}"],
+                                    capture_output=True, text=True, check=False)
+            lines = result.stdout.splitlines()
+            if len(lines) == 2 and lines[0] != "??":
+                return f"{lines[0]} at {Path(lines[1]).name}"
+        function = self.elf.function_at(address)
+        return function.name if function else ""
+
+
+def load_record(elf, dump, base):
+    symbol = elf.symbol("tm4c_crash_record")
+    if symbol is None:
+        raise SystemExit("the ELF has no tm4c_crash_record, is fault.c linked in?")
+
+    offset = 0 if base is None else symbol.value - base
+    data = dump[offset:offset + RECORD.size]
+    if offset < 0 or len(data) < RECORD.size:
+        raise SystemExit("the dump does not contain the crash record")
+
+    words = RECORD.unpack(data)
+    record = dict(zip(FIELDS, words))
+    record["stack"] = words[len(FIELDS):-1]
+    record["crc"] = words[-1]
+
+    if record["magic"] != MAGIC:
+        raise SystemExit(f"no crash recorded (magic 0x{record['magic']:08x})")
+    if record["version"] != VERSION:
+        raise SystemExit(f"unsupported record version {record['version']}")
+    if zlib.crc32(data[:-4]) != record["crc"]:
+        raise SystemExit("the crash record is corrupt (CRC mismatch)")
+    return record
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("elf", help="the firmware ELF file that crashed")
+    parser.add_argument("dump", help="binary dump of the record or of SRAM")
+    parser.add_argument("--base", type=lambda s: int(s, 0), default=None,
+                        help="address the dump starts at, for dumps of all of SRAM")
+    args = parser.parse_args()
+
+    elf = Elf32(args.elf)
+    record = load_record(elf, Path(args.dump).read_bytes(), args.base)
+    symbolize = Symbolizer(args.elf, elf)
+
+    vector = record["vector"]
+    name = EXCEPTIONS.get(vector, f"IRQ {vector - 16}" if vector >= 16 else "?")
+    print(f"Crash #{record['count']}: {name} (vector {vector})")
+
+    for register in ("pc", "lr"):
+        print(f"  {register:<4} 0x{record[register]:08x}  {symbolize(record[register])}")
+    for register in ("r0", "r1", "r2", "r3", "r12"):
+        print(f"  {register:<4} 0x{record[register]:08x}")
+    print(f"  xpsr 0x{record['xpsr']:08x}")
+
+    stack = "PSP" if record["exc_return"] & 0x4 else "MSP"
+    fpu = "" if record["exc_return"] & 0x10 else ", FPU context stacked"
+    print(f"  sp   0x{record['sp']:08x}  ({stack}{fpu})")
+
+    print(f"  HFSR 0x{record['hfsr']:08x}  {flags(record['hfsr'], HFSR_BITS)}")
+    print(f"  CFSR 0x{record['cfsr']:08x}  {flags(record['cfsr'], CFSR_BITS)}")
+    if record["cfsr"] & (1 << 7):
+        print(f"  MMFAR 0x{record['mmfar']:08x}")
+    if record["cfsr"] & (1 << 15):
+        print(f"  BFAR 0x{record['bfar']:08x}")
+
+    print("  stack:")
+    for i, word in enumerate(record["stack"]):
+        # return addresses are the only thing worth resolving on the stack
+        where = symbolize(word) if word & 1 else ""
+        print(f"    [sp+0x{4 * i:02x}] 0x{word:08x}  {where}")
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,247 @@
+#!/usr/bin/env python3
+"""
+file name:
+    decode_log.py
+
+details:
+    turns the records of the deferred binary log (TM4C_LOG, see
+    boards/ek-tm4c123gxl/include/tm4c_log.h) back into text. The format
+    strings are read from the .tm4c_log section of the ELF, which is never
+    loaded into the chip.
+
+    The input is either a dump of the tm4c_log ring taken from SRAM (also
+    after a crash, the ring survives warm resets) or, with --stream, the bytes
+    tm4c_log_drain() handed to its sink, e.g. a capture of the UART. Bytes
+    that do not form a valid record are skipped, so a capture may start in
+    the middle of a record.
+
+example:
+    (gdb) dump binary value log.bin tm4c_log
+    $ ./decode_log.py blinky.elf log.bin
+        [     1234567] adc 3: -12 mV
+        [     1240003] state idle -> run
+    $ ./decode_log.py --stream --hz 80000000 blinky.elf uart.bin
+        [  0.015432 s] adc 3: -12 mV
+
+author(s):
+    @astroesteban
+"""
+import argparse
+import re
+import struct
+import sys
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).resolve().parent))
+from elf32 import Elf32  # noqa: E402
+
+MARKER = 0xA5
+MAX_ARGS = 8
+HEADER_WORDS = 3                # head, tail and dropped before the buffer
+
+CONVERSION = re.compile(
+    r"%(?P<flags>[-+ #0]*)(?P<width>\*|\d+)?(?:\.(?P<precision>\*|\d+))?"
+    r"(?P<length>hh|h|ll|l|j|z|t|L)?(?P<conversion>[diouxXeEfFgGaAcsp%])")
+
+
+class Formatter:
+    """Renders printf style format strings with the argument words of a
+    record, the way newlib would have rendered them on the target."""
+
+    def __init__(self, elf):
+        self.elf = elf
+
+    def string(self, address):
+        text = bytearray()
+        try:
+            while len(text) < 256:
+                byte = self.elf.read(address + len(text), 1)[0]
+                if byte == 0:
+                    return text.decode("utf-8", errors="replace")
+                text.append(byte)
+        except ValueError:
+            pass
+        return f"<string at 0x{address:08x}>"
+
+    def value(self, spec, word):
+        conversion, length = spec["conversion"], spec["length"] or ""
+        bits = {"hh": 8, "h": 16}.get(length, 32)
+        word &= (1 << bits) - 1
+
+        if conversion in "di":
+            return word - (1 << bits) if word >> (bits - 1) else word
+        if conversion in "ouxX":
+            return word
+        if conversion in "eEfFgGaA":
+            return struct.unpack("<f", struct.pack("<I", word))[0]
+        if conversion == "c":
+            return chr(word & 0xFF)
+        if conversion == "s":
+            return self.string(word)
+        return f"0x{word:x}"                            # %p
+
+    def __call__(self, template, args):
+        args = list(args)
+
+        def take():
+            return args.pop(0) if args else 0
+
+        def replace(match):
+            spec = match.groupdict()
+            if spec["conversion"] == "%":
+                return "%"
+
+            width, precision = spec["width"] or "", spec["precision"]
+            if width == "*":
+                width = str(struct.unpack("<i", struct.pack("<I", take()))[0])
+            if precision == "*":
+                precision = str(take())
+
+            value = self.value(spec, take())
+            conversion = {"i": "d", "u": "d", "p": "s", "F": "f"}.get(spec["conversion"],
+                                                                       spec["conversion"])
+            if conversion in "aA":
+                return value.hex()
+            python = "%" + spec["flags"] + width
+            if precision is not None:
+                python += "." + precision
+            return (python + conversion) % value
+
+        return CONVERSION.sub(replace, template)
+
+
+class Decoder:
+    """Splits a sequence of words into records and renders them."""
+
+    def __init__(self, elf, hz):
+        self.strings = elf.section_data(".tm4c_log")
+        if not self.strings:
+            raise SystemExit("the ELF has no .tm4c_log section, does it use TM4C_LOG?")
+        self.format = Formatter(elf)
+        self.hz = hz
+        self.skipped = 0
+
+    def template(self, header):
+        """The format string of a header word, None if it is no header."""
+        identifier, count = header & 0xFFFFF, (header >> 20) & 0xF
+        if header >> 24 != MARKER or count > MAX_ARGS or identifier >= len(self.strings):
+            return None
+        # IDs point at the first character of a string
+        if identifier > 0 and self.strings[identifier - 1] != 0:
+            return None
+        end = self.strings.index(b"\0", identifier)
+        return self.strings[identifier:end].decode("utf-8", errors="replace")
+
+    def line(self, template, words):
+        timestamp, args = words[0], words[1:]
+        if self.hz:
+            stamp = f"{timestamp / self.hz:10.6f} s"
+        else:
+            stamp = f"{timestamp:12d}"
+        return f"[{stamp}] {self.format(template, args)}"
+
+    def words(self, words):
+        """Decodes word aligned records (a dump of the ring)."""
+        index = 0
+        while index < len(words):
+            template = self.template(words[index])
+            count = (words[index] >> 20) & 0xF
+            if template is None or index + 2 + count > len(words):
+                self.skipped += 4
+                index += 1
+                continue
+            yield self.line(template, words[index + 1:index + 2 + count])
+            index += 2 + count
+
+    def record(self, data, index=0):
+        """Decodes the record at data[index:]. Returns the line and the bytes
+        it took, (None, 1) for a byte that starts no record and (None, 0) if
+        the record is not complete yet."""
+        if index + 8 > len(data):
+            return None, 0
+        (header,) = struct.unpack_from("<I", data, index)
+        template = self.template(header)
+        if template is None:
+            return None, 1
+        count = (header >> 20) & 0xF
+        if index + 4 * (2 + count) > len(data):
+            return None, 0
+        words = struct.unpack_from(f"<{1 + count}I", data, index + 4)
+        return self.line(template, words), 4 * (2 + count)
+
+    def stream(self, data):
+        """Decodes a byte stream that may have lost bytes (a capture)."""
+        index = 0
+        while True:
+            line, taken = self.record(data, index)
+            if taken == 0:
+                break
+            if line is None:
+                self.skipped += 1
+            else:
+                yield line
+            index += taken
+        self.skipped += len(data) - index
+
+
+def ring_words(elf, dump, base, everything):
+    """The words of the records in a dump of tm4c_log, oldest first."""
+    symbol = elf.symbol("tm4c_log")
+    if symbol is None:
+        raise SystemExit("the ELF has no tm4c_log, is log.c linked in?")
+
+    offset = 0 if base is None else symbol.value - base
+    data = dump[offset:offset + symbol.size]
+    if offset < 0 or len(data) < symbol.size:
+        raise SystemExit("the dump does not contain tm4c_log")
+
+    head, tail, dropped = struct.unpack_from(f"<{HEADER_WORDS}I", data)
+    buffer = struct.unpack_from(f"<{symbol.size // 4 - HEADER_WORDS}I", data, 4 * HEADER_WORDS)
+    size = len(buffer)
+
+    pending = (head - tail) & 0xFFFFFFFF
+    if pending > size:
+        raise SystemExit(f"the ring is corrupt (head {head}, tail {tail})")
+    if dropped:
+        print(f"({dropped} records were dropped because the ring was full)")
+
+    # everything: the drained records that are not overwritten yet as well
+    first = head - size if everything and head >= size else (0 if everything else tail)
+    return [buffer[i % size] for i in range(first, head)]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("elf", help="the firmware ELF file that logged")
+    parser.add_argument("input", help="dump of tm4c_log (or of SRAM), or a capture with --stream")
+    parser.add_argument("--stream", action="store_true",
+                        help="the input is what tm4c_log_drain() sent, not a dump of the ring")
+    parser.add_argument("--base", type=lambda s: int(s, 0), default=None,
+                        help="address the dump starts at, for dumps of all of SRAM")
+    parser.add_argument("--all", action="store_true",
+                        help="also decode the records of the dump that were already drained")
+    parser.add_argument("--hz", type=float, default=None,
+                        help="core clock, prints timestamps in seconds instead of cycles")
+    args = parser.parse_args()
+
+    elf = Elf32(args.elf)
+    decoder = Decoder(elf, args.hz)
+    data = Path(args.input).read_bytes()
+
+    if args.stream:
+        lines = decoder.stream(data)
+    else:
+        lines = decoder.words(ring_words(elf, data, args.base, args.all))
+
+    for line in lines:
+        print(line)
+
+    # a ring that was overwritten starts in the middle of a record
+    if decoder.skipped:
+        print(f"({decoder.skipped} bytes did not belong to a record)")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
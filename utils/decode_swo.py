@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+"""
+file name:
+    decode_swo.py
+
+details:
+    splits a captured SWO stream (ITM packets, e.g. from OpenOCD's
+    `tpiu config internal swo.bin uart off ...`) into the ports the board
+    library writes to (see boards/ek-tm4c123gxl/include/tm4c_itm.h):
+
+        port 0      text (stdout/stderr), printed as it is
+        port 1      TM4C_LOG records, decoded with the ELF given by --elf
+        port 8-31   counters, printed as "counter n: value"
+        other       printed as hex
+
+    Synchronization, overflow, timestamp and hardware (DWT) packets are
+    skipped. The capture may start anywhere, the decoder resynchronizes on
+    the next valid packet.
+
+example:
+    $ ./decode_swo.py --elf blinky.elf swo.bin
+        booting
+        [     1234567] adc 3: -12 mV
+        counter 2: 1000
+
+author(s):
+    @astroesteban
+"""
+import argparse
+import sys
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).resolve().parent))
+from decode_log import Decoder  # noqa: E402
+from elf32 import Elf32  # noqa: E402
+
+PORT_TEXT = 0
+PORT_LOG = 1
+PORT_COUNTERS = 8
+PAYLOAD_SIZES = {1: 1, 2: 2, 3: 4}
+
+
+def packets(data):
+    """Yields (port, payload) of the software source packets in the stream,
+    and (None, description) for the other packets worth reporting."""
+    index = 0
+    while index < len(data):
+        header = data[index]
+        index += 1
+
+        if header == 0x00:                              # synchronization
+            while index < len(data) and data[index] == 0x00:
+                index += 1
+            if index < len(data) and data[index] == 0x80:
+                index += 1
+        elif header == 0x70:
+            yield None, "overflow, the ITM FIFO lost packets"
+        elif header & 0x03:                             # source packet
+            size = PAYLOAD_SIZES[header & 0x03]
+            payload = data[index:index + size]
+            index += size
+            if len(payload) == size and not header & 0x04:
+                yield header >> 3, payload
+        elif header & 0x0F == 0 or header in (0x94, 0xB4) or header & 0x0B == 0x08:
+            # local timestamp, global timestamp and extension packets carry
+            # continuation bytes as long as bit 7 is set
+            more = header & 0x80
+            while more and index < len(data):
+                more = data[index] & 0x80
+                index += 1
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("capture", help="the captured SWO stream")
+    parser.add_argument("--elf", help="the firmware ELF file, needed to decode TM4C_LOG records")
+    parser.add_argument("--hz", type=float, default=None,
+                        help="core clock, prints log timestamps in seconds instead of cycles")
+    args = parser.parse_args()
+
+    decoder = Decoder(Elf32(args.elf), args.hz) if args.elf else None
+    log = bytearray()
+    text = sys.stdout
+
+    for port, payload in packets(Path(args.capture).read_bytes()):
+        if port is None:
+            print(f"({payload})")
+        elif port == PORT_TEXT:
+            text.write(payload.decode("utf-8", errors="replace"))
+        elif port == PORT_LOG:
+            log += payload
+            while decoder is not None:
+                line, taken = decoder.record(log)
+                if taken == 0:
+                    break
+                if line is not None:
+                    print(line)
+                else:
+                    decoder.skipped += 1
+                del log[:taken]
+        elif port >= PORT_COUNTERS and len(payload) == 4:
+            print(f"counter {port - PORT_COUNTERS}: {int.from_bytes(payload, 'little')}")
+        else:
+            print(f"port {port}: {payload.hex()}")
+
+    if log and decoder is None:
+        print(f"({len(log)} bytes of TM4C_LOG records, pass --elf to decode them)")
+    elif decoder is not None and decoder.skipped + len(log):
+        print(f"({decoder.skipped + len(log)} log bytes did not belong to a record)")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,127 @@
+"""
+file name:
+    elf32.py
+
+details:
+    minimal reader for the 32-bit little endian ELF files the toolchain
+    produces. Only what the host tools in this directory need: the section
+    headers, the symbol table and reading memory by address. Keeps the tools
+    free of third-party python packages.
+
+author(s):
+    @astroesteban
+"""
+import shutil
+import struct
+import subprocess
+from dataclasses import dataclass
+
+SHT_NOBITS = 8
+SHF_ALLOC = 0x2
+STT_FUNC = 2
+
+
+@dataclass
+class Section:
+    name: str
+    type: int
+    flags: int
+    addr: int
+    offset: int
+    size: int
+
+
+@dataclass
+class Symbol:
+    name: str
+    value: int
+    size: int
+    type: int
+
+
+class Elf32:
+    """An ELF32 little endian file loaded into memory."""
+
+    def __init__(self, path):
+        with open(path, "rb") as elf:
+            self.data = elf.read()
+
+        if self.data[:4] != b"\x7fELF" or self.data[4] != 1 or self.data[5] != 1:
+            raise ValueError(f"{path} is not a 32-bit little endian ELF file")
+
+        (shoff,) = struct.unpack_from("<I", self.data, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from("<HHH", self.data, 0x2E)
+
+        headers = [struct.unpack_from("<IIIIIIIIII", self.data, shoff + i * shentsize)
+                   for i in range(shnum)]
+        names = headers[shstrndx][4]
+
+        self.sections = [Section(self._string(names + h[0]), h[1], h[2], h[3], h[4], h[5])
+                         for h in headers]
+        self._links = [h[6] for h in headers]
+        self._symbols = None
+
+    def _string(self, offset):
+        end = self.data.index(b"\0", offset)
+        return self.data[offset:end].decode("utf-8", errors="replace")
+
+    def section(self, name):
+        """Returns the section with the given name or None."""
+        return next((s for s in self.sections if s.name == name), None)
+
+    def section_data(self, name):
+        """Returns the content of the section, empty if it has none."""
+        section = self.section(name)
+        if section is None or section.type == SHT_NOBITS:
+            return b""
+        return self.data[section.offset:section.offset + section.size]
+
+    def symbols(self):
+        """Returns every symbol of .symtab."""
+        if self._symbols is None:
+            self._symbols = []
+            index = next((i for i, s in enumerate(self.sections) if s.name == ".symtab"), None)
+            if index is not None:
+                symtab = self.sections[index]
+                strtab = self.sections[self._links[index]]
+                for offset in range(symtab.offset, symtab.offset + symtab.size, 16):
+                    name, value, size, info = struct.unpack_from("<IIIB", self.data, offset)
+                    self._symbols.append(Symbol(self._string(strtab.offset + name),
+                                                value, size, info & 0xF))
+        return self._symbols
+
+    def symbol(self, name):
+        """Returns the symbol with the given name or None."""
+        return next((s for s in self.symbols() if s.name == name), None)
+
+    def function_at(self, address):
+        """Returns the function containing the address or None. The Thumb bit
+        of the address is ignored."""
+        address &= ~1
+        for symbol in self.symbols():
+            start = symbol.value & ~1
+            if symbol.type == STT_FUNC and start <= address < start + max(symbol.size, 1):
+                return symbol
+        return None
+
+    def read(self, address, size):
+        """Reads bytes by their run address from the loaded sections. Sections
+        that are never loaded (.tm4c_log, debug info) have no run address, even
+        though they are linked at 0 like .text."""
+        for section in self.sections:
+            if (section.type != SHT_NOBITS and section.flags & SHF_ALLOC and
+                    section.addr <= address and address + size <= section.addr + section.size):
+                start = section.offset + address - section.addr
+                return self.data[start:start + size]
+        raise ValueError(f"0x{address:08x} is not in a loaded section")
+
+
+def demangle(names, cxxfilt="arm-none-eabi-c++filt"):
+    """Demangles C++ symbol names if c++filt is available."""
+    tool = shutil.which(cxxfilt) or shutil.which("c++filt")
+    if tool is None or not names:
+        return list(names)
+    result = subprocess.run([tool], input="\n".join(names), capture_output=True,
+                            text=True, check=False)
+    lines = result.stdout.splitlines()
+    return lines if len(lines) == len(names) else list(names)
@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+"""
+file name:
+    include_cost.py
+
+details:
+    measures what including headers costs at compile time. Each source is
+    compiled --runs times with the given compiler and flags, the report shows
+    the median wall time, the lines the compiler parses after preprocessing
+    and the lines of the headers it reads (the preprocessor reads every line
+    of a macro header, even though almost none survive preprocessing). The
+    first source is the baseline the others are compared with.
+
+example:
+    $ ./include_cost.py --compiler arm-none-eabi-g++ --flags "-std=c++23 -O2 -I..." \\
+          monolithic.cpp per_peripheral.cpp
+        source                   median   vs first   parsed lines   header lines
+        monolithic.cpp          31.2 ms      1.00x              9          10519
+        per_peripheral.cpp      24.0 ms      0.77x           1702           1445
+
+author(s):
+    @astroesteban
+"""
+import argparse
+import os
+import shlex
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+from pathlib import Path
+
+
+def compile_time(command, runs):
+    times = []
+    for _ in range(runs):
+        start = time.perf_counter()
+        subprocess.run(command, check=True)
+        times.append(time.perf_counter() - start)
+    return statistics.median(times)
+
+
+def header_lines(compiler, flags, source):
+    """Lines of every header the compiler opens for source (from -H)"""
+    result = subprocess.run([compiler, *flags, "-H", "-E", source, "-o", os.devnull],
+                            check=True, capture_output=True, text=True)
+    headers = {line.lstrip(".").strip() for line in result.stderr.splitlines() if line.startswith(".")}
+    return sum(len(Path(h).read_text(errors="replace").splitlines()) for h in headers if Path(h).is_file())
+
+
+def parsed_lines(compiler, flags, source):
+    result = subprocess.run([compiler, *flags, "-E", "-P", source],
+                            check=True, capture_output=True, text=True)
+    return sum(1 for line in result.stdout.splitlines() if line.strip())
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("sources", nargs="+", help="the sources to compile, the first is the baseline")
+    parser.add_argument("--compiler", default="c++", help="the compiler to measure")
+    parser.add_argument("--flags", default="", help="compiler flags, one string")
+    parser.add_argument("--runs", type=int, default=20, help="compilations per source")
+    args = parser.parse_args()
+
+    flags = shlex.split(args.flags)
+    print(f"{'source':<24} {'median':>9} {'vs first':>10} {'parsed lines':>14} {'header lines':>14}")
+    baseline = None
+    with tempfile.TemporaryDirectory() as directory:
+        output = str(Path(directory) / "out.o")
+        for source in args.sources:
+            seconds = compile_time([args.compiler, *flags, "-c", source, "-o", output], args.runs)
+            baseline = baseline or seconds
+            print(f"{Path(source).name:<24} {seconds * 1000:6.1f} ms {seconds / baseline:9.2f}x "
+                  f"{parsed_lines(args.compiler, flags, source):14} "
+                  f"{header_lines(args.compiler, flags, source):14}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,67 @@
+#!/usr/bin/env python3
+"""
+file name:
+    static_init_report.py
+
+details:
+    lists every dynamic initializer __libc_init_array runs before main(),
+    i.e. the entries of .preinit_array and .init_array, together with the
+    size of the function. Each entry is usually a `_GLOBAL__sub_I_<file>`
+    function holding the constructors of all the globals of one translation
+    unit. Globals that can be turned into constinit/constexpr make the entry
+    smaller or drop it completely.
+
+example:
+    $ ./static_init_report.py switches.elf
+        Dynamic initializers in switches.elf
+          0x00000a41    48 B  .init_array     _GLOBAL__sub_I_switches.cpp
+        1 initializer(s), 48 bytes of code
+
+author(s):
+    @astroesteban
+"""
+import argparse
+import struct
+import sys
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).resolve().parent))
+from elf32 import Elf32, demangle  # noqa: E402
+
+ARRAYS = (".preinit_array", ".init_array")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("elf", help="the firmware ELF file")
+    parser.add_argument("--max", type=int, default=None,
+                        help="fail if there are more initializers than this")
+    args = parser.parse_args()
+
+    elf = Elf32(args.elf)
+
+    entries = []
+    for name in ARRAYS:
+        data = elf.section_data(name)
+        for (address,) in struct.iter_unpack("<I", data):
+            entries.append((name, address, elf.function_at(address)))
+
+    names = demangle([f.name if f else "?" for _, _, f in entries])
+
+    print(f"Dynamic initializers in {Path(args.elf).name}")
+    total = 0
+    for (array, address, function), name in zip(entries, names):
+        size = function.size if function else 0
+        total += size
+        print(f"  0x{address:08x} {size:5} B  {array:<15} {name}")
+    print(f"{len(entries)} initializer(s), {total} bytes of code")
+
+    if args.max is not None and len(entries) > args.max:
+        print(f"error: more than {args.max} dynamic initializer(s)", file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
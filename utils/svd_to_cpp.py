@@ -0,0 +1,271 @@
+#!/usr/bin/env python3
+"""
+file name:
+    svd_to_cpp.py
+
+details:
+    generates C++ register definitions (tm4c_register.hpp types) from a
+    CMSIS-SVD file, one small header per peripheral group, so a translation
+    unit only parses the peripherals it uses. Peripherals with the same
+    register layout (GPIOA ... GPIOF_AHB, UART0 ... UART7) share one class
+    template over the base address:
+
+        tm4c_svd/gpio.hpp
+            namespace tm4c::svd::gpio {
+            template <std::uint32_t Base> struct Peripheral {
+                using DIR = tm4c::Register<Base + 0x400>;
+                struct LOCK : tm4c::Register<Base + 0x520> { ... fields ... };
+                ...
+            };
+            }
+            namespace tm4c::svd { using GPIOF = gpio::Peripheral<0x40025000>; ... }
+
+    Fields become static constexpr tm4c::Field members of their register,
+    named without the "<GROUP>_<REGISTER>_" prefix of the SVD, enumerated
+    values become an enum class <FIELD>_Value. tm4c_svd/all.hpp includes
+    every header. Files whose content did not change are not rewritten, so
+    regenerating does not trigger rebuilds.
+
+example:
+    $ ./svd_to_cpp.py --list tm4c123gxl.svd
+        tm4c_svd/watchdog.hpp
+        tm4c_svd/gpio.hpp
+        ...
+    $ ./svd_to_cpp.py tm4c123gxl.svd --output build/svd
+        14 headers, 51 peripherals, 399 registers, 1484 fields
+
+author(s):
+    @astroesteban
+"""
+import argparse
+import re
+import sys
+import xml.etree.ElementTree as ET
+from pathlib import Path
+
+DIRECTORY = "tm4c_svd"
+ACCESS = {"read-only": "tm4c::Access::ReadOnly", "write-only": "tm4c::Access::WriteOnly"}
+
+# Where the SVD disagrees with the datasheet, {(group, register): access}
+ACCESS_FIXES = {
+    ("gpio", "CR"): "read-write",       # writable once GPIOLOCK is unlocked (section 10.6)
+}
+
+# Peripherals of the SVD's TM4C1230C3PM that the TM4C123GH6PM does not have.
+# Accessing them faults, so they get no definitions.
+EXCLUDED = {
+    "GPIOG", "GPIOG_AHB",               # the 64-pin package has ports A-F
+    "I2C4", "I2C5",                     # four I2C modules (section 16)
+}
+
+
+def identifier(name):
+    """Names that start with a digit (UART 9BITADDR, RCC XTAL 4MHZ) get an underscore"""
+    name = re.sub(r"\W", "_", name)
+    return "_" + name if name[0].isdigit() else name
+
+
+def strip_prefix(name, prefix):
+    """The part of name after prefix (SYSCTL_RCC_XTAL -> XTAL), None if it has no such prefix"""
+    index = name.find(prefix)
+    return name[index + len(prefix):] if index >= 0 and len(name) > index + len(prefix) else None
+
+
+def comment(text):
+    return " ".join((text or "").replace("\\n", " ").split())
+
+
+class Field:
+    def __init__(self, node, register):
+        self.description = comment(node.findtext("description"))
+        msb, lsb = (int(x) for x in re.match(r"\[(\d+):(\d+)\]", node.findtext("bitRange")).groups())
+        self.offset = lsb
+        self.width = msb - lsb + 1
+
+        # a field covering the register is named after it in the SVD (WDT_LOAD)
+        full = node.findtext("name")
+        self.name = identifier(strip_prefix(full, f"{register.lstrip('_')}_") or "VALUE")
+
+        self.values = []
+        for value in node.iterfind("enumeratedValues/enumeratedValue"):
+            number = int(value.findtext("value"), 0)
+            name = identifier(strip_prefix(value.findtext("name"), f"{full}_") or value.findtext("name"))
+            if number < (1 << self.width) and name not in (n for n, _, _ in self.values):
+                self.values.append((name, number, comment(value.findtext("description"))))
+
+    def key(self):
+        return (self.name, self.offset, self.width, tuple(self.values))
+
+
+class Register:
+    def __init__(self, node, group):
+        self.name = identifier(node.findtext("name"))
+        self.description = comment(node.findtext("description"))
+        self.offset = int(node.findtext("addressOffset"), 0)
+        self.access = ACCESS_FIXES.get((group, self.name)) or node.findtext("access") or "read-write"
+        self.fields = []
+        names = set()
+        for field in node.iterfind("fields/field"):
+            field = Field(field, node.findtext("name"))
+            # a member must not have the name of its class (TIMER TAMR_TAMR)
+            if field.name == self.name:
+                field.name = "VALUE"
+            while field.name in names or field.name == self.name:
+                field.name += "_"
+            names.add(field.name)
+            self.fields.append(field)
+
+    def key(self):
+        return (self.name, self.offset, self.access, tuple(f.key() for f in self.fields))
+
+
+class Peripheral:
+    def __init__(self, node, base):
+        self.name = identifier(node.findtext("name"))
+        self.address = int(node.findtext("baseAddress"), 0)
+        self.description = comment(node.findtext("description"))
+        source = base if base is not None else node
+        self.group = (source.findtext("groupName") or source.findtext("name")).lower()
+        self.registers = []
+        names = set()
+        for node in source.iterfind("registers/register"):
+            register = Register(node, self.group)
+            # the second view of an address in an alternate group (I2C MCS)
+            if register.name in names:
+                register.name += "_" + (node.findtext("alternateGroup") or "ALT").split("_")[-1]
+            names.add(register.name)
+            self.registers.append(register)
+
+    def layout(self):
+        return tuple(r.key() for r in self.registers)
+
+
+def load(path):
+    device = ET.parse(path).getroot()
+    nodes = {p.findtext("name"): p for p in device.iterfind("peripherals/peripheral")}
+    # an excluded peripheral may still be what others are derived from
+    return [Peripheral(node, nodes.get(node.get("derivedFrom")))
+            for name, node in nodes.items() if name not in EXCLUDED]
+
+
+def groups(peripherals):
+    """{header name: [peripherals]} in the order of the SVD"""
+    grouped = {}
+    for peripheral in peripherals:
+        grouped.setdefault(peripheral.group, []).append(peripheral)
+    # a group of one is named after its peripheral (UDM -> udma, but CAN0 -> can)
+    def name(group, members):
+        single = members[0].name.lower()
+        return single if len(members) == 1 and single.rstrip("0123456789") != group else group
+    return {name(group, members): members for group, members in grouped.items()}
+
+
+def render_register(register, indent):
+    pad = " " * indent
+    access = f", {ACCESS[register.access]}" if register.access in ACCESS else ""
+    base = f"tm4c::Register<Base + 0x{register.offset:03X}{access}>"
+    lines = [f"{pad}/// {register.description}"] if register.description else []
+    if not register.fields:
+        lines.append(f"{pad}using {register.name} = {base};")
+        return lines
+
+    lines.append(f"{pad}struct {register.name} : {base} {{")
+    for field in register.fields:
+        if field.values:
+            lines.append(f"{pad}    enum class {field.name}_Value : std::uint32_t {{")
+            for name, number, description in field.values:
+                note = f" // {description}" if description else ""
+                lines.append(f"{pad}        {name} = 0x{number:X},{note}")
+            lines.append(f"{pad}    }};")
+            kind = f"{field.name}_Value"
+        else:
+            kind = "bool" if field.width == 1 else "std::uint32_t"
+        note = f" // {field.description}" if field.description else ""
+        lines.append(f"{pad}    static constexpr tm4c::Field<{field.offset}, {field.width}, {kind}> "
+                     f"{field.name}{{}};{note}")
+    lines.append(f"{pad}}};")
+    return lines
+
+
+def render(header, members, source):
+    layouts = {}
+    for peripheral in members:
+        layouts.setdefault(peripheral.layout(), []).append(peripheral)
+    names = {}
+    for index, layout in enumerate(layouts):
+        names[layout] = "Peripheral" if index == 0 else f"Peripheral_{layouts[layout][0].name}"
+
+    listed = ", ".join(p.name for p in members)
+    lines = [
+        "/**",
+        f" * @file {header}.hpp",
+        f" * @brief {header.upper()} registers ({listed}).",
+        f" * @details Generated by utils/svd_to_cpp.py from {source}, do not edit.",
+        " */",
+        "#pragma once",
+        "",
+        "#include <cstdint>",
+        "",
+        '#include "tm4c_register.hpp"',
+        "",
+        f"namespace tm4c::svd::{header} {{",
+    ]
+    for layout, peripherals in layouts.items():
+        lines += ["", "template <std::uint32_t Base>", f"struct {names[layout]} {{",
+                  "    static constexpr std::uint32_t base = Base;"]
+        for register in peripherals[0].registers:
+            lines.append("")
+            lines += render_register(register, 4)
+        lines.append("};")
+    lines += ["", f"}} // namespace tm4c::svd::{header}", "", "namespace tm4c::svd {", ""]
+    for peripheral in members:
+        note = f" // {peripheral.description}" if peripheral.description else ""
+        lines.append(f"using {peripheral.name} = {header}::{names[peripheral.layout()]}"
+                     f"<0x{peripheral.address:08X}>;{note}")
+    lines += ["", "} // namespace tm4c::svd", ""]
+    return "\n".join(lines)
+
+
+def write(path, text):
+    if path.exists() and path.read_text() == text:
+        return
+    path.parent.mkdir(parents=True, exist_ok=True)
+    path.write_text(text)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("svd", help="the CMSIS-SVD file")
+    parser.add_argument("--output", type=Path, default=Path("."),
+                        help=f"directory the {DIRECTORY}/ headers are written to")
+    parser.add_argument("--list", action="store_true",
+                        help="only print the headers that would be generated")
+    args = parser.parse_args()
+
+    peripherals = load(args.svd)
+    grouped = groups(peripherals)
+    headers = [f"{DIRECTORY}/{name}.hpp" for name in grouped] + [f"{DIRECTORY}/all.hpp"]
+
+    if args.list:
+        print("\n".join(headers))
+        return 0
+
+    source = Path(args.svd).name
+    for name, members in grouped.items():
+        write(args.output / DIRECTORY / f"{name}.hpp", render(name, members, source))
+    write(args.output / DIRECTORY / "all.hpp", "\n".join(
+        ["/**", " * @file all.hpp", " * @brief Every peripheral, for code that really needs them all.",
+         f" * @details Generated by utils/svd_to_cpp.py from {source}, do not edit.", " */",
+         "#pragma once", ""] + [f'#include "{name}.hpp"' for name in grouped]) + "\n")
+
+    layouts = {p.layout(): p for p in peripherals}.values()
+    registers = sum(len(p.registers) for p in layouts)
+    fields = sum(len(r.fields) for p in layouts for r in p.registers)
+    print(f"{len(grouped)} headers, {len(peripherals)} peripherals, "
+          f"{registers} registers, {fields} fields")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())